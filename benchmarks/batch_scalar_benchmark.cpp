@@ -0,0 +1,68 @@
+#include "../src/BatchEvaluation.h"
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+/*
+ * Scalar batch kernel against per-point Horner: one point waits on a dependent multiply-add per coeff,
+ * ScalarInterleave points per coeff step keep independent chains in flight. Items are Horner steps (degree * points)
+ */
+
+constexpr indexType BenchmarkDegree = 32;
+constexpr indexType BenchmarkPoints = 1024;
+
+struct BenchmarkData {
+    Polynom<scalar, BenchmarkDegree> polynom;
+    std::vector<scalar> points, out;
+
+    BenchmarkData() : points(BenchmarkPoints), out(BenchmarkPoints) {
+        for (indexType i = 0; i < BenchmarkDegree + 1; ++i) {
+            polynom[i] = 1. / static_cast<scalar>(i + 1);
+        }
+        for (indexType j = 0; j < points.size(); ++j) {
+            points[j] = -1 + 2 * static_cast<scalar>(j) / BenchmarkPoints;
+        }
+    }
+};
+
+template<Kernel K>
+static void PerPoint(benchmark::State &state) {
+
+    BenchmarkData data;
+
+    for (auto _: state) {
+        for (indexType j = 0; j < BenchmarkPoints; ++j) {
+            data.out[j] = K == Kernel::Horner ? Horner(data.polynom, data.points[j])
+                                              : CompensatedHorner(data.polynom, data.points[j]);
+        }
+        benchmark::DoNotOptimize(data.out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * BenchmarkDegree * BenchmarkPoints);
+}
+
+template<Kernel K>
+static void Interleaved(benchmark::State &state) {
+
+    BenchmarkData data;
+    SetInstructionSet(InstructionSet::Scalar);
+
+    for (auto _: state) {
+        if constexpr (K == Kernel::Horner) {
+            HornerBatch(data.polynom, data.points.data(), BenchmarkPoints, data.out.data());
+        } else {
+            CompensatedHornerBatch(data.polynom, data.points.data(), BenchmarkPoints, data.out.data());
+        }
+        benchmark::DoNotOptimize(data.out.data());
+        benchmark::ClobberMemory();
+    }
+
+    SetInstructionSet(DetectInstructionSet());
+    state.SetItemsProcessed(state.iterations() * BenchmarkDegree * BenchmarkPoints);
+}
+
+BENCHMARK(PerPoint<Kernel::Horner>);
+BENCHMARK(Interleaved<Kernel::Horner>);
+BENCHMARK(PerPoint<Kernel::Compensated>);
+BENCHMARK(Interleaved<Kernel::Compensated>);
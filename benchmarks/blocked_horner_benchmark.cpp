@@ -0,0 +1,71 @@
+#include "../src/BlockedHorner.h"
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+/*
+ * Per-point Horner against the blocked kernel for growing degrees and 64 points.
+ * While the coeffs fit in cache both are compute-bound; beyond the last level cache per-point Horner streams
+ * the coeffs from memory for every point and becomes memory-bound, the blocked kernel reads them once per batch.
+ * The counter coeff_bytes marks the crossover, items are Horner steps (degree * points)
+ */
+
+constexpr indexType BenchmarkPoints = 64;
+
+struct BenchmarkData {
+    std::vector<scalar> coeffs, points, out;
+
+    explicit BenchmarkData(const indexType degree) : coeffs(degree + 1), points(BenchmarkPoints),
+                                                     out(BenchmarkPoints) {
+        for (indexType i = 0; i < coeffs.size(); ++i) {
+            coeffs[i] = 1. / static_cast<scalar>(i + 1);
+        }
+        for (indexType j = 0; j < points.size(); ++j) {
+            points[j] = -1 + 2 * static_cast<scalar>(j) / BenchmarkPoints;
+        }
+    }
+};
+
+template<Kernel K>
+static void PerPoint(benchmark::State &state) {
+
+    BenchmarkData data(state.range(0));
+    const PolynomView<scalar> polynom(data.coeffs.data(), data.coeffs.size() - 1);
+
+    for (auto _: state) {
+        for (indexType j = 0; j < BenchmarkPoints; ++j) {
+            data.out[j] = K == Kernel::Horner ? Horner(polynom, data.points[j])
+                                              : CompensatedHorner(polynom, data.points[j]);
+        }
+        benchmark::DoNotOptimize(data.out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * BenchmarkPoints);
+    state.counters["coeff_bytes"] = static_cast<double>(data.coeffs.size() * sizeof(scalar));
+}
+
+template<Kernel K>
+static void Blocked(benchmark::State &state) {
+
+    BenchmarkData data(state.range(0));
+    const PolynomView<scalar> polynom(data.coeffs.data(), data.coeffs.size() - 1);
+
+    for (auto _: state) {
+        if constexpr (K == Kernel::Horner) {
+            BlockedHornerBatch(polynom, data.points.data(), BenchmarkPoints, data.out.data());
+        } else {
+            BlockedCompensatedHornerBatch(polynom, data.points.data(), BenchmarkPoints, data.out.data());
+        }
+        benchmark::DoNotOptimize(data.out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * BenchmarkPoints);
+    state.counters["coeff_bytes"] = static_cast<double>(data.coeffs.size() * sizeof(scalar));
+}
+
+BENCHMARK(PerPoint<Kernel::Horner>)->RangeMultiplier(4)->Range(1 << 8, 1 << 22);
+BENCHMARK(Blocked<Kernel::Horner>)->RangeMultiplier(4)->Range(1 << 8, 1 << 22);
+BENCHMARK(PerPoint<Kernel::Compensated>)->RangeMultiplier(4)->Range(1 << 8, 1 << 22);
+BENCHMARK(Blocked<Kernel::Compensated>)->RangeMultiplier(4)->Range(1 << 8, 1 << 22);
@@ -0,0 +1,297 @@
+#ifndef POLYNOMEVALUATION_BATCHEVALUATION_H
+#define POLYNOMEVALUATION_BATCHEVALUATION_H
+
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define POLYNOMEVALUATION_X86_DISPATCH 1
+#else
+#define POLYNOMEVALUATION_X86_DISPATCH 0
+#endif
+
+/**
+ * Number of points evaluated together by the batched kernels, one AVX-512 register of doubles
+ */
+constexpr indexType BatchWidth = 8;
+
+/**
+ * Number of points interleaved by the scalar kernel: independent Horner chains per coeff step
+ * hide the latency of the dependent multiply-add without vector registers
+ */
+constexpr indexType ScalarInterleave = 8;
+
+/**
+ * Evaluation algorithm of the batch entry points
+ */
+enum class Kernel {
+    Horner,
+    Compensated
+};
+
+/**
+ * Instruction set of the batch kernels, ordered by capability. SSE2 is the x86-64 baseline: its kernel is the
+ * portable one with Dekker's products, it differs from Scalar only in builds for FMA targets, where Scalar uses fma.
+ * The scalar entry points take the product chosen at compile time by FloatTraits<T>::has_fma, so builds without
+ * FMA in the target never call the software fma of libm
+ */
+enum class InstructionSet {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+/**
+ * Best instruction set supported by the CPU (cpuid via the compiler builtins)
+ * @return instruction set, AVX2 requires FMA as well
+ */
+inline InstructionSet DetectInstructionSet() {
+#if POLYNOMEVALUATION_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return InstructionSet::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return InstructionSet::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return InstructionSet::SSE2;
+    }
+#endif
+    return InstructionSet::Scalar;
+}
+
+namespace Detail {
+
+    inline std::atomic<InstructionSet> &ActiveInstructionSet() {
+        static std::atomic<InstructionSet> instruction_set{DetectInstructionSet()};
+        return instruction_set;
+    }
+}
+
+/**
+ * Instruction set used by the batch entry points, detected once on first use
+ * @return active instruction set
+ */
+inline InstructionSet GetInstructionSet() {
+    return Detail::ActiveInstructionSet().load(std::memory_order_relaxed);
+}
+
+/**
+ * Restricts the batch entry points to the given instruction set, capped by what the CPU supports
+ * @param instruction_set requested instruction set
+ * @return instruction set that is actually used
+ */
+inline InstructionSet SetInstructionSet(const InstructionSet &instruction_set) {
+    const InstructionSet active = std::min(instruction_set, DetectInstructionSet());
+    Detail::ActiveInstructionSet().store(active, std::memory_order_relaxed);
+    return active;
+}
+
+namespace Detail {
+
+    /**
+     * Error-free product of the kernels: FMA kernels are compiled for an FMA target, so std::fma is
+     * the instruction even where FloatTraits<T>::has_fma is false for the build
+     */
+    template<bool FMA, typename T>
+    [[gnu::always_inline]] inline ReturnStruct<T> KernelTwoProduct(const T &a, const T &b) {
+        if constexpr (FMA) {
+            ReturnStruct<T> out;
+
+            out.result = a * b;
+            out.error = std::fma(a, b, -out.result);
+
+            return out;
+        } else {
+            return TwoProduct(a, b);
+        }
+    }
+
+    /**
+     * Horner or compensated Horner for Width points, every step is a loop over the points.
+     * The bound is the a posteriori bound of CompensatedHornerWithBound
+     */
+    template<Kernel K, bool WithBound, bool FMA, indexType Width, typename T, indexType N>
+    [[gnu::always_inline]] inline void BatchBlock(const Polynom<T, N> &polynom, const T *x, T *out, T *bound) {
+
+        T sum[Width];
+        for (indexType j = 0; j < Width; ++j) {
+            sum[j] = polynom[N];
+        }
+
+        if constexpr (K == Kernel::Horner) {
+
+            for (indexType i = N; i >= 1; i--) {
+                for (indexType j = 0; j < Width; ++j) {
+                    sum[j] = sum[j] * x[j] + polynom[i - 1];
+                }
+            }
+
+            for (indexType j = 0; j < Width; ++j) {
+                out[j] = sum[j];
+            }
+
+        } else {
+
+            T error[Width], abs_error[Width];
+            for (indexType j = 0; j < Width; ++j) {
+                error[j] = 0;
+                abs_error[j] = 0;
+            }
+
+            for (indexType i = N; i >= 1; i--) {
+                for (indexType j = 0; j < Width; ++j) {
+
+                    const ReturnStruct<T> p = KernelTwoProduct<FMA>(sum[j], x[j]);
+                    const ReturnStruct<T> s = TwoSum(p.result, polynom[i - 1]);
+
+                    sum[j] = s.result;
+                    error[j] = error[j] * x[j] + (p.error + s.error);
+                    if constexpr (WithBound) {
+                        abs_error[j] = abs_error[j] * std::abs(x[j]) + (std::abs(p.error) + std::abs(s.error));
+                    }
+                }
+            }
+
+            for (indexType j = 0; j < Width; ++j) {
+                out[j] = sum[j] + error[j];
+            }
+
+            if constexpr (WithBound) {
+                const T u = UnitRoundoff<T>();
+                const T gamma = Gamma<T>(4 * N + 2);
+
+                for (indexType j = 0; j < Width; ++j) {
+                    const T abs_result = std::abs(out[j]);
+                    bound[j] = (u * abs_result + (gamma * abs_error[j] + 2 * u * u * abs_result)) /
+                               (1 - 2 * (N + 1) * u);
+                }
+            }
+        }
+    }
+
+    /**
+     * Full blocks of Width points, the tail point by point
+     */
+    template<Kernel K, bool WithBound, bool FMA, indexType Width = BatchWidth, typename T, indexType N>
+    [[gnu::always_inline]] inline void BatchKernel(const Polynom<T, N> &polynom, const T *x, const indexType size,
+                                                   T *out, T *bound) {
+        for (indexType begin = 0; begin < size; begin += Width) {
+            if (begin + Width <= size) {
+                BatchBlock<K, WithBound, FMA, Width>(polynom, x + begin, out + begin,
+                                                     WithBound ? bound + begin : bound);
+            } else {
+                for (indexType i = begin; i < size; ++i) {
+                    BatchBlock<K, WithBound, FMA, 1>(polynom, x + i, out + i, WithBound ? bound + i : bound);
+                }
+            }
+        }
+    }
+
+    /**
+     * Portable kernel, ScalarInterleave points per coeff step. Hardware fma is used where the compiler reports
+     * it as fast for T (FloatTraits<T>::has_fma), otherwise the products are Dekker's
+     */
+    template<Kernel K, bool WithBound, typename T, indexType N>
+    void BatchScalar(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out, T *bound) {
+        BatchKernel<K, WithBound, FloatTraits<T>::has_fma, ScalarInterleave>(polynom, x, size, out, bound);
+    }
+
+#if POLYNOMEVALUATION_X86_DISPATCH
+
+    template<Kernel K, bool WithBound, typename T, indexType N>
+    __attribute__((target("sse2"))) POLYNOMEVALUATION_NO_CONTRACT
+    void BatchSSE2(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out, T *bound) {
+        BatchKernel<K, WithBound, false>(polynom, x, size, out, bound);
+    }
+
+    template<Kernel K, bool WithBound, typename T, indexType N>
+    __attribute__((target("avx2,fma")))
+    void BatchAVX2(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out, T *bound) {
+        BatchKernel<K, WithBound, true>(polynom, x, size, out, bound);
+    }
+
+    template<Kernel K, bool WithBound, typename T, indexType N>
+    __attribute__((target("avx512f,avx2,fma")))
+    void BatchAVX512(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out, T *bound) {
+        BatchKernel<K, WithBound, true>(polynom, x, size, out, bound);
+    }
+
+#endif
+
+    /**
+     * Runs the kernel compiled for the active instruction set
+     */
+    template<Kernel K, bool WithBound, typename T, indexType N>
+    void DispatchBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out, T *bound) {
+#if POLYNOMEVALUATION_X86_DISPATCH
+        switch (GetInstructionSet()) {
+            case InstructionSet::AVX512:
+                BatchAVX512<K, WithBound>(polynom, x, size, out, bound);
+                return;
+            case InstructionSet::AVX2:
+                BatchAVX2<K, WithBound>(polynom, x, size, out, bound);
+                return;
+            case InstructionSet::SSE2:
+                BatchSSE2<K, WithBound>(polynom, x, size, out, bound);
+                return;
+            case InstructionSet::Scalar:
+                break;
+        }
+#endif
+        BatchScalar<K, WithBound>(polynom, x, size, out, bound);
+    }
+}
+
+/**
+ * Batched Horner scheme with runtime choice of the instruction set
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out polynom values
+ */
+template<typename T, indexType N>
+void HornerBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out) {
+    Detail::DispatchBatch<Kernel::Horner, false>(polynom, x, size, out, static_cast<T *>(nullptr));
+}
+
+/**
+ * Batched compensated Horner scheme with runtime choice of the instruction set.
+ * Kernels without FMA use Dekker's TwoProduct, so no software fma is ever called.
+ * Results may differ from CompensatedHorner in the last bits where the compiler fuses the correction update
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out polynom values
+ */
+template<typename T, indexType N>
+void CompensatedHornerBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out) {
+    Detail::DispatchBatch<Kernel::Compensated, false>(polynom, x, size, out, static_cast<T *>(nullptr));
+}
+
+/**
+ * Batched compensated Horner scheme with a posteriori error bounds, see CompensatedHornerWithBound
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out polynom values
+ * @param bound error bounds of the values
+ */
+template<typename T, indexType N>
+void CompensatedHornerWithBoundBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out,
+                                     T *bound) {
+    Detail::DispatchBatch<Kernel::Compensated, true>(polynom, x, size, out, bound);
+}
+
+#endif //POLYNOMEVALUATION_BATCHEVALUATION_H
@@ -0,0 +1,210 @@
+#ifndef POLYNOMEVALUATION_BERNSTEINPOLYNOM_H
+#define POLYNOMEVALUATION_BERNSTEINPOLYNOM_H
+
+#include "PolynomEvaluation.h"
+
+#include <cmath>
+
+/**
+ * Number of parameters evaluated together by the batched de Casteljau kernels
+ */
+constexpr indexType BernsteinBatchWidth = 8;
+
+/**
+ * Polynom in Bernstein basis: p(t) = sum of b_i * C(N, i) * (1 - t) ^ (N - i) * t ^ i, t in [0, 1]
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ */
+template<typename T, indexType N>
+class BernsteinPolynom {
+
+private:
+    Containers::array<T, N + 1> data_;
+
+public:
+
+    constexpr BernsteinPolynom() = default;
+
+    constexpr BernsteinPolynom(const Containers::array<T, N + 1> &coeffs) noexcept : data_(coeffs) {}
+
+    const T &operator[](const indexType &i) const {
+        return data_[i];
+    }
+
+    T &operator[](const indexType &i) {
+        return data_[i];
+    }
+};
+
+/**
+ * De Casteljau algorithm
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs in Bernstein basis
+ * @param t parameter in [0, 1]
+ * @return polynom value in t
+ */
+template<typename T, indexType N>
+T DeCasteljau(const BernsteinPolynom<T, N> &polynom, const T &t) {
+
+    const T r = 1 - t;
+    Containers::array<T, N + 1> b;
+    for (indexType i = 0; i < N + 1; ++i) {
+        b[i] = polynom[i];
+    }
+
+    for (indexType j = 1; j < N + 1; ++j) {
+        for (indexType i = 0; i + j < N + 1; ++i) {
+            b[i] = r * b[i] + t * b[i + 1];
+        }
+    }
+
+    return b[0];
+}
+
+namespace Detail {
+
+    /**
+     * Compensated de Casteljau for Width parameters (Jiang, Li, Barrio, Wang): 1 - t = r + rho exactly,
+     * the errors of the products and sums of every level run through the same triangle as the correction.
+     * The triangle is updated in place, for small N and Width it stays in registers
+     */
+    template<bool WithBound, indexType Width, typename T, indexType N>
+    [[gnu::always_inline]] inline void CompensatedDeCasteljauBlock(const BernsteinPolynom<T, N> &polynom,
+                                                                   const T *t, T *out, T *bound) {
+
+        T r[Width], rho[Width];
+        T b[N + 1][Width], c[N + 1][Width], abs_b[N + 1][Width];
+
+        for (indexType k = 0; k < Width; ++k) {
+            const ReturnStruct<T> difference = TwoSum(T(1), -t[k]);
+            r[k] = difference.result;
+            rho[k] = difference.error;
+        }
+
+        for (indexType i = 0; i < N + 1; ++i) {
+            for (indexType k = 0; k < Width; ++k) {
+                b[i][k] = polynom[i];
+                c[i][k] = 0;
+                if constexpr (WithBound) {
+                    abs_b[i][k] = std::abs(polynom[i]);
+                }
+            }
+        }
+
+        for (indexType j = 1; j < N + 1; ++j) {
+            for (indexType i = 0; i + j < N + 1; ++i) {
+                for (indexType k = 0; k < Width; ++k) {
+
+                    const ReturnStruct<T> first = TwoProductFMA(r[k], b[i][k]);
+                    const ReturnStruct<T> second = TwoProductFMA(t[k], b[i + 1][k]);
+                    const ReturnStruct<T> s = TwoSum(first.result, second.result);
+
+                    const T w = (first.error + second.error) + (s.error + rho[k] * b[i][k]);
+
+                    b[i][k] = s.result;
+                    c[i][k] = (r[k] * c[i][k] + t[k] * c[i + 1][k]) + w;
+
+                    if constexpr (WithBound) {
+                        abs_b[i][k] = r[k] * abs_b[i][k] + t[k] * abs_b[i + 1][k];
+                    }
+                }
+            }
+        }
+
+        for (indexType k = 0; k < Width; ++k) {
+            out[k] = b[0][k] + c[0][k];
+        }
+
+        if constexpr (WithBound) {
+            const T u = UnitRoundoff<T>();
+            const T gamma = Gamma<T>(3 * N + 2);
+
+            for (indexType k = 0; k < Width; ++k) {
+                bound[k] = (u * std::abs(out[k]) + 2 * gamma * gamma * abs_b[0][k] * (1 + Gamma<T>(2 * N + 1))) /
+                           (1 - u);
+            }
+        }
+    }
+
+    template<bool WithBound, typename T, indexType N>
+    void CompensatedDeCasteljauKernel(const BernsteinPolynom<T, N> &polynom, const T *t, const indexType size,
+                                      T *out, T *bound) {
+        indexType begin = 0;
+
+        for (; begin + BernsteinBatchWidth <= size; begin += BernsteinBatchWidth) {
+            CompensatedDeCasteljauBlock<WithBound, BernsteinBatchWidth>(polynom, t + begin, out + begin,
+                                                                         WithBound ? bound + begin : bound);
+        }
+
+        for (; begin < size; ++begin) {
+            CompensatedDeCasteljauBlock<WithBound, 1>(polynom, t + begin, out + begin,
+                                                       WithBound ? bound + begin : bound);
+        }
+    }
+}
+
+/**
+ * Compensated de Casteljau algorithm, as accurate as de Casteljau in twice the working precision
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs in Bernstein basis
+ * @param t parameter in [0, 1]
+ * @return polynom value in t
+ */
+template<typename T, indexType N>
+T CompensatedDeCasteljau(const BernsteinPolynom<T, N> &polynom, const T &t) {
+    T out;
+    Detail::CompensatedDeCasteljauBlock<false, 1>(polynom, &t, &out, static_cast<T *>(nullptr));
+    return out;
+}
+
+/**
+ * Compensated de Casteljau algorithm with error bound
+ * |result - p(t)| <= (u * |result| + 2 * gamma_{3N+2} ^ 2 * sum of |b_i| * B_i(t)) / (1 - u),
+ * the sum is evaluated by de Casteljau on the same triangle. Underflow is not taken into account
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs in Bernstein basis
+ * @param t parameter in [0, 1]
+ * @return struct: polynom value in t and its error bound
+ */
+template<typename T, indexType N>
+BoundStruct<T> CompensatedDeCasteljauWithBound(const BernsteinPolynom<T, N> &polynom, const T &t) {
+    BoundStruct<T> out;
+    Detail::CompensatedDeCasteljauBlock<true, 1>(polynom, &t, &out.result, &out.bound);
+    return out;
+}
+
+/**
+ * Compensated de Casteljau algorithm for many parameters, BernsteinBatchWidth at a time.
+ * Results are equal to CompensatedDeCasteljau
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs in Bernstein basis
+ * @param t parameters in [0, 1]
+ * @param size number of parameters
+ * @param out polynom values
+ */
+template<typename T, indexType N>
+void CompensatedDeCasteljauBatch(const BernsteinPolynom<T, N> &polynom, const T *t, const indexType size, T *out) {
+    Detail::CompensatedDeCasteljauKernel<false>(polynom, t, size, out, static_cast<T *>(nullptr));
+}
+
+/**
+ * Compensated de Casteljau algorithm with error bounds for many parameters
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs in Bernstein basis
+ * @param t parameters in [0, 1]
+ * @param size number of parameters
+ * @param out polynom values
+ * @param bound error bounds of the values
+ */
+template<typename T, indexType N>
+void CompensatedDeCasteljauWithBoundBatch(const BernsteinPolynom<T, N> &polynom, const T *t, const indexType size,
+                                          T *out, T *bound) {
+    Detail::CompensatedDeCasteljauKernel<true>(polynom, t, size, out, bound);
+}
+
+#endif //POLYNOMEVALUATION_BERNSTEINPOLYNOM_H
@@ -0,0 +1,225 @@
+#ifndef POLYNOMEVALUATION_BLOCKEDHORNER_H
+#define POLYNOMEVALUATION_BLOCKEDHORNER_H
+
+#include "BatchEvaluation.h"
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Coeffs per block of the blocked kernels, 8 KB of doubles: a block stays in L1 while all points pass over it
+ */
+constexpr indexType BlockedHornerCoeffs = 1024;
+
+/**
+ * Points advanced together over one block, their sums and corrections live in registers
+ */
+constexpr indexType BlockedHornerPoints = 8;
+
+namespace Detail {
+
+    /**
+     * Prefetch for a single use (non-temporal hint), the coeffs are streamed once per batch
+     */
+    template<typename T>
+    [[gnu::always_inline]] inline void PrefetchStream(const T *address) {
+#if defined(__GNUC__)
+        __builtin_prefetch(address, 0, 0);
+#endif
+    }
+
+    /**
+     * Horner steps i = end - 1, ..., begin for Width points, the state is kept in sum and error between blocks
+     */
+    template<Kernel K, bool FMA, indexType Width, typename T>
+    [[gnu::always_inline]] inline void BlockedHornerBlock(const T *coeffs, const indexType begin, const indexType end,
+                                                          const T *x, T *sum, T *error) {
+
+        T s[Width], e[Width];
+        for (indexType j = 0; j < Width; ++j) {
+            s[j] = sum[j];
+            if constexpr (K == Kernel::Compensated) {
+                e[j] = error[j];
+            }
+        }
+
+        for (indexType i = end; i > begin; i--) {
+            const T a = coeffs[i - 1];
+
+            for (indexType j = 0; j < Width; ++j) {
+                if constexpr (K == Kernel::Horner) {
+                    s[j] = s[j] * x[j] + a;
+                } else {
+                    const ReturnStruct<T> p = KernelTwoProduct<FMA>(s[j], x[j]);
+                    const ReturnStruct<T> t = TwoSum(p.result, a);
+
+                    s[j] = t.result;
+                    e[j] = e[j] * x[j] + (p.error + t.error);
+                }
+            }
+        }
+
+        for (indexType j = 0; j < Width; ++j) {
+            sum[j] = s[j];
+            if constexpr (K == Kernel::Compensated) {
+                error[j] = e[j];
+            }
+        }
+    }
+
+    /**
+     * Coeffs are traversed once from the highest block down, every block is applied to all points
+     * before the next one, which is prefetched meanwhile
+     */
+    template<Kernel K, bool FMA, typename T>
+    [[gnu::always_inline]] inline void BlockedHornerKernel(const T *coeffs, const indexType degree, const T *x,
+                                                           const indexType size, T *out, T *error) {
+
+        constexpr indexType line = 64 / sizeof(T);
+
+        for (indexType end = degree; end > 0;) {
+            const indexType begin = end > BlockedHornerCoeffs ? end - BlockedHornerCoeffs : 0;
+
+            for (indexType next = begin; next > 0 && begin - next < BlockedHornerCoeffs;
+                 next = next > line ? next - line : 0) {
+                PrefetchStream(coeffs + next - 1);
+            }
+
+            for (indexType group = 0; group < size; group += BlockedHornerPoints) {
+                if (group + BlockedHornerPoints <= size) {
+                    BlockedHornerBlock<K, FMA, BlockedHornerPoints>(coeffs, begin, end, x + group, out + group,
+                                                                    error + group);
+                } else {
+                    for (indexType j = group; j < size; ++j) {
+                        BlockedHornerBlock<K, FMA, 1>(coeffs, begin, end, x + j, out + j, error + j);
+                    }
+                }
+            }
+
+            end = begin;
+        }
+    }
+
+    template<Kernel K, typename T>
+    POLYNOMEVALUATION_NO_CONTRACT
+    void BlockedDekker(const T *coeffs, const indexType degree, const T *x, const indexType size, T *out, T *error) {
+        BlockedHornerKernel<K, false>(coeffs, degree, x, size, out, error);
+    }
+
+    /**
+     * Portable kernel: hardware fma where the build has a fast one for T (FloatTraits<T>::has_fma, as BatchScalar),
+     * Dekker's products compiled without contraction otherwise
+     */
+    template<Kernel K, typename T>
+    void BlockedScalar(const T *coeffs, const indexType degree, const T *x, const indexType size, T *out, T *error) {
+        if constexpr (FloatTraits<T>::has_fma) {
+            BlockedHornerKernel<K, true>(coeffs, degree, x, size, out, error);
+        } else {
+            BlockedDekker<K>(coeffs, degree, x, size, out, error);
+        }
+    }
+
+#if POLYNOMEVALUATION_X86_DISPATCH
+
+    template<Kernel K, typename T>
+    __attribute__((target("sse2"))) POLYNOMEVALUATION_NO_CONTRACT
+    void BlockedSSE2(const T *coeffs, const indexType degree, const T *x, const indexType size, T *out, T *error) {
+        BlockedHornerKernel<K, false>(coeffs, degree, x, size, out, error);
+    }
+
+    template<Kernel K, typename T>
+    __attribute__((target("avx2,fma")))
+    void BlockedAVX2(const T *coeffs, const indexType degree, const T *x, const indexType size, T *out, T *error) {
+        BlockedHornerKernel<K, true>(coeffs, degree, x, size, out, error);
+    }
+
+    template<Kernel K, typename T>
+    __attribute__((target("avx512f,avx2,fma")))
+    void BlockedAVX512(const T *coeffs, const indexType degree, const T *x, const indexType size, T *out, T *error) {
+        BlockedHornerKernel<K, true>(coeffs, degree, x, size, out, error);
+    }
+
+#endif
+
+    /**
+     * Runs the blocked kernel compiled for the active instruction set of the batch entry points
+     */
+    template<Kernel K, typename T>
+    void DispatchBlocked(const PolynomView<T> &polynom, const T *x, const indexType size, T *out) {
+
+        const T *coeffs = polynom.Data();
+        const indexType degree = polynom.Degree();
+
+        std::vector<T> error(size, T(0));
+        for (indexType j = 0; j < size; ++j) {
+            out[j] = coeffs[degree];
+        }
+
+        switch (GetInstructionSet()) {
+#if POLYNOMEVALUATION_X86_DISPATCH
+            case InstructionSet::AVX512:
+                BlockedAVX512<K>(coeffs, degree, x, size, out, error.data());
+                break;
+            case InstructionSet::AVX2:
+                BlockedAVX2<K>(coeffs, degree, x, size, out, error.data());
+                break;
+            case InstructionSet::SSE2:
+                BlockedSSE2<K>(coeffs, degree, x, size, out, error.data());
+                break;
+#endif
+            default:
+                BlockedScalar<K>(coeffs, degree, x, size, out, error.data());
+                break;
+        }
+
+        if constexpr (K == Kernel::Compensated) {
+            for (indexType j = 0; j < size; ++j) {
+                out[j] += error[j];
+            }
+        }
+    }
+}
+
+/**
+ * Horner scheme for many points and high degrees (above 10 ^ 4 coeffs exceed L1 and L2): the coeffs are read
+ * from memory once per batch in blocks of BlockedHornerCoeffs, so their bandwidth is shared by all points.
+ * The kernel follows the instruction set of the batch entry points. The SSE2 kernel, and the Scalar one in builds
+ * without fast fma, never fuse: their results are equal to Horner compiled without contraction
+ * @tparam T floating point type
+ * @param polynom view of FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out polynom values
+ */
+template<typename T>
+void BlockedHornerBatch(const PolynomView<T> &polynom, const T *x, const indexType size, T *out) {
+    Detail::DispatchBlocked<Kernel::Horner>(polynom, x, size, out);
+}
+
+template<typename T, indexType N>
+void BlockedHornerBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out) {
+    BlockedHornerBatch(PolynomView<T>(polynom), x, size, out);
+}
+
+/**
+ * Compensated Horner scheme for many points and high degrees, blocked as BlockedHornerBatch.
+ * Kernels without fma never fuse, their results are equal to CompensatedHorner of the polynom view compiled
+ * without contraction. FMA kernels may fuse the correction update
+ * @tparam T floating point type
+ * @param polynom view of FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out polynom values
+ */
+template<typename T>
+void BlockedCompensatedHornerBatch(const PolynomView<T> &polynom, const T *x, const indexType size, T *out) {
+    Detail::DispatchBlocked<Kernel::Compensated>(polynom, x, size, out);
+}
+
+template<typename T, indexType N>
+void BlockedCompensatedHornerBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out) {
+    BlockedCompensatedHornerBatch(PolynomView<T>(polynom), x, size, out);
+}
+
+#endif //POLYNOMEVALUATION_BLOCKEDHORNER_H
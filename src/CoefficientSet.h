@@ -0,0 +1,267 @@
+#ifndef POLYNOMEVALUATION_COEFFICIENTSET_H
+#define POLYNOMEVALUATION_COEFFICIENTSET_H
+
+#include "MappedFile.h"
+#include "PolynomEvaluation.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Binary coefficient set, native byte order, every block starts at a multiple of CoefficientSetAlignment:
+ *
+ * header     CoefficientSetHeader
+ * directory  CoefficientSetEntry[count]
+ * data       per polynom: coeffs[degree + 1], then optionally split highs[degree + 1] and split lows[degree + 1]
+ *
+ * Loading maps the file and validates the header only, views point straight into the mapping.
+ */
+
+constexpr std::uint32_t CoefficientSetVersion = 1;
+constexpr indexType CoefficientSetAlignment = 64;
+constexpr char CoefficientSetMagic[8] = {'P', 'O', 'L', 'Y', 'S', 'E', 'T', '\0'};
+
+enum class CoefficientType : std::uint16_t {
+    Float32 = 1,
+    Float64 = 2
+};
+
+enum CoefficientSetFlags : std::uint16_t {
+    HasSplits = 1
+};
+
+struct CoefficientSetHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t entry_size;
+    std::uint64_t count;
+    std::uint64_t directory_offset;
+    std::uint64_t reserved[4];
+};
+
+struct CoefficientSetEntry {
+    std::uint64_t degree;
+    std::uint16_t type;
+    std::uint16_t flags;
+    std::uint32_t reserved;
+    std::uint64_t coeffs_offset;
+    std::uint64_t splits_offset;
+};
+
+static_assert(sizeof(CoefficientSetHeader) == CoefficientSetAlignment);
+
+/**
+ * Coefficient type tag of the floating point type
+ * @tparam T float or double
+ * @return type tag
+ */
+template<typename T>
+constexpr CoefficientType GetCoefficientType() {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "only float and double coeffs are stored");
+    return std::is_same_v<T, float> ? CoefficientType::Float32 : CoefficientType::Float64;
+}
+
+/**
+ * Polynom view with optional precomputed Veltkamp splits of the coeffs,
+ * the splits feed Dekker's products of PowerTable::Evaluate on targets without FMA
+ * @tparam T floating point type
+ */
+template<typename T>
+struct StoredPolynomView {
+    PolynomView<T> coeffs;
+    PolynomView<T> split_high;
+    PolynomView<T> split_low;
+
+    bool HasSplits() const {
+        return split_high.Data() != nullptr;
+    }
+};
+
+/**
+ * Writes polynoms to the binary coefficient set
+ * @tparam T float or double
+ * @param path path to the file, created or truncated
+ * @param polynoms views of the polynoms
+ * @param with_splits store Veltkamp splits of the coeffs
+ */
+template<typename T>
+void WriteCoefficientSet(const std::string &path, const std::vector<PolynomView<T>> &polynoms,
+                         const bool with_splits = false) {
+
+    auto align = [](const std::uint64_t offset) {
+        return (offset + CoefficientSetAlignment - 1) / CoefficientSetAlignment * CoefficientSetAlignment;
+    };
+
+    CoefficientSetHeader header{};
+    std::memcpy(header.magic, CoefficientSetMagic, sizeof(header.magic));
+    header.version = CoefficientSetVersion;
+    header.entry_size = sizeof(CoefficientSetEntry);
+    header.count = polynoms.size();
+    header.directory_offset = sizeof(CoefficientSetHeader);
+
+    std::vector<CoefficientSetEntry> directory(polynoms.size());
+    std::uint64_t offset = align(header.directory_offset + polynoms.size() * sizeof(CoefficientSetEntry));
+
+    for (indexType i = 0; i < polynoms.size(); ++i) {
+        const std::uint64_t block_size = (polynoms[i].Degree() + 1) * sizeof(T);
+
+        directory[i] = {};
+        directory[i].degree = polynoms[i].Degree();
+        directory[i].type = static_cast<std::uint16_t>(GetCoefficientType<T>());
+        directory[i].flags = with_splits ? HasSplits : 0;
+        directory[i].coeffs_offset = offset;
+        offset = align(offset + block_size);
+
+        if (with_splits) {
+            directory[i].splits_offset = offset;
+            offset = align(offset + 2 * block_size);
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("cannot open " + path);
+    }
+
+    auto write_at = [&](const std::uint64_t position, const void *data, const indexType size) {
+        const std::vector<char> padding(position - static_cast<std::uint64_t>(file.tellp()), 0);
+        file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    };
+
+    write_at(0, &header, sizeof(header));
+    write_at(header.directory_offset, directory.data(), directory.size() * sizeof(CoefficientSetEntry));
+
+    for (indexType i = 0; i < polynoms.size(); ++i) {
+        const indexType coeffs_size = polynoms[i].Degree() + 1;
+        write_at(directory[i].coeffs_offset, polynoms[i].Data(), coeffs_size * sizeof(T));
+
+        if (with_splits) {
+            std::vector<T> splits(2 * coeffs_size);
+            for (indexType j = 0; j < coeffs_size; ++j) {
+                const ReturnStruct<T> split = Split(polynoms[i][j]);
+                splits[j] = split.result;
+                splits[coeffs_size + j] = split.error;
+            }
+            write_at(directory[i].splits_offset, splits.data(), splits.size() * sizeof(T));
+        }
+    }
+
+    if (!file) {
+        throw std::runtime_error("cannot write " + path);
+    }
+}
+
+/**
+ * Memory-mapped binary coefficient set. Construction maps the file and checks the header only,
+ * so its cost does not depend on the number of polynoms; entries are checked when viewed
+ */
+class CoefficientSet {
+
+private:
+    MappedFile file_;
+    const CoefficientSetHeader *header_ = nullptr;
+    const CoefficientSetEntry *directory_ = nullptr;
+
+    const char *Bytes() const {
+        return static_cast<const char *>(file_.Data());
+    }
+
+    void CheckRange(const std::uint64_t offset, const std::uint64_t size) const {
+        if (offset % CoefficientSetAlignment != 0 || offset > file_.Size() || size > file_.Size() - offset) {
+            throw std::runtime_error("coefficient set block is out of the file or misaligned");
+        }
+    }
+
+    void CheckIndex(const indexType &i) const {
+        if (i >= Size()) {
+            throw std::out_of_range("coefficient set index is out of range");
+        }
+    }
+
+public:
+
+    /**
+     * Maps the coefficient set
+     * @param path path to the file
+     */
+    explicit CoefficientSet(const std::string &path) : file_(path) {
+
+        if (file_.Size() < sizeof(CoefficientSetHeader)) {
+            throw std::runtime_error(path + " is too small for a coefficient set");
+        }
+
+        header_ = reinterpret_cast<const CoefficientSetHeader *>(Bytes());
+
+        if (std::memcmp(header_->magic, CoefficientSetMagic, sizeof(header_->magic)) != 0) {
+            throw std::runtime_error(path + " is not a coefficient set");
+        }
+        if (header_->version != CoefficientSetVersion || header_->entry_size != sizeof(CoefficientSetEntry)) {
+            throw std::runtime_error(path + " has unsupported coefficient set version");
+        }
+        if (header_->count > file_.Size() / sizeof(CoefficientSetEntry)) {
+            throw std::runtime_error(path + " has corrupted directory");
+        }
+
+        CheckRange(header_->directory_offset, header_->count * sizeof(CoefficientSetEntry));
+        directory_ = reinterpret_cast<const CoefficientSetEntry *>(Bytes() + header_->directory_offset);
+    }
+
+    indexType Size() const {
+        return header_->count;
+    }
+
+    indexType Degree(const indexType &i) const {
+        CheckIndex(i);
+        return directory_[i].degree;
+    }
+
+    CoefficientType Type(const indexType &i) const {
+        CheckIndex(i);
+        return static_cast<CoefficientType>(directory_[i].type);
+    }
+
+    /**
+     * Zero-copy view of the polynom, usable with Horner and CompensatedHorner
+     * @tparam T float or double, must match the stored type
+     * @param i polynom index
+     * @return view of the coeffs and of the splits if they are stored
+     */
+    template<typename T>
+    StoredPolynomView<T> View(const indexType &i) const {
+
+        CheckIndex(i);
+
+        const CoefficientSetEntry &entry = directory_[i];
+
+        if (entry.type != static_cast<std::uint16_t>(GetCoefficientType<T>())) {
+            throw std::invalid_argument("coefficient set entry has a different coefficient type");
+        }
+        if (entry.degree >= file_.Size() / sizeof(T)) {
+            throw std::runtime_error("coefficient set entry has corrupted degree");
+        }
+
+        const std::uint64_t block_size = (entry.degree + 1) * sizeof(T);
+
+        StoredPolynomView<T> out;
+
+        CheckRange(entry.coeffs_offset, block_size);
+        out.coeffs = PolynomView<T>(reinterpret_cast<const T *>(Bytes() + entry.coeffs_offset), entry.degree);
+
+        if (entry.flags & HasSplits) {
+            CheckRange(entry.splits_offset, 2 * block_size);
+            const T *splits = reinterpret_cast<const T *>(Bytes() + entry.splits_offset);
+            out.split_high = PolynomView<T>(splits, entry.degree);
+            out.split_low = PolynomView<T>(splits + entry.degree + 1, entry.degree);
+        }
+
+        return out;
+    }
+};
+
+#endif //POLYNOMEVALUATION_COEFFICIENTSET_H
@@ -0,0 +1,285 @@
+#ifndef POLYNOMEVALUATION_COMPENSATEDSUMMATION_H
+#define POLYNOMEVALUATION_COMPENSATEDSUMMATION_H
+
+#include "PolynomEvaluation.h"
+
+#include <cmath>
+#include <vector>
+
+/**
+ * Number of independent accumulators of Sum2 and Dot2, the lanes run in parallel on SIMD units
+ */
+constexpr indexType SummationLanes = 4;
+
+/**
+ * Summation in twice the working precision (Ogita, Rump, Oishi, Sum2) with SummationLanes accumulators
+ * @tparam T floating point type
+ * @param values summands
+ * @param size number of summands
+ * @return sum, |result - s| <= u * |s| + gamma_{n-1} ^ 2 * sum of |values|
+ */
+template<typename T>
+T Sum2(const T *values, const indexType size) {
+
+    T sum[SummationLanes] = {}, error[SummationLanes] = {};
+
+    indexType i = 0;
+    for (; i + SummationLanes <= size; i += SummationLanes) {
+        for (indexType l = 0; l < SummationLanes; ++l) {
+            const ReturnStruct<T> s = TwoSum(sum[l], values[i + l]);
+            sum[l] = s.result;
+            error[l] += s.error;
+        }
+    }
+
+    T total_sum = 0, total_error = 0;
+
+    for (; i < size; ++i) {
+        const ReturnStruct<T> s = TwoSum(total_sum, values[i]);
+        total_sum = s.result;
+        total_error += s.error;
+    }
+
+    for (indexType l = 0; l < SummationLanes; ++l) {
+        const ReturnStruct<T> s = TwoSum(total_sum, sum[l]);
+        total_sum = s.result;
+        total_error += s.error + error[l];
+    }
+
+    return total_sum + total_error;
+}
+
+/**
+ * Summation in K-fold working precision (Ogita, Rump, Oishi, SumK): K - 1 error-free vector transformations
+ * followed by a plain sum
+ * @tparam T floating point type
+ * @param values summands
+ * @param size number of summands
+ * @param K precision factor, K >= 1
+ * @return sum, |result - s| <= (u + 3 * gamma_{n-1} ^ 2) * |s| + gamma_{2n-2} ^ K * sum of |values|
+ */
+template<typename T>
+T SumK(const T *values, const indexType size, const indexType K) {
+
+    if (size == 0) {
+        return 0;
+    }
+
+    std::vector<T> p(values, values + size);
+
+    for (indexType k = 1; k < K; ++k) {
+        for (indexType i = 1; i < size; ++i) {
+            const ReturnStruct<T> s = TwoSum(p[i], p[i - 1]);
+            p[i] = s.result;
+            p[i - 1] = s.error;
+        }
+    }
+
+    T sum = 0;
+    for (indexType i = 0; i + 1 < size; ++i) {
+        sum += p[i];
+    }
+
+    return sum + p[size - 1];
+}
+
+/**
+ * Dot product in twice the working precision (Ogita, Rump, Oishi, Dot2) with SummationLanes accumulators
+ * @tparam T floating point type
+ * @param x first vector
+ * @param y second vector
+ * @param size vector length
+ * @return dot product, |result - x^T y| <= u * |x^T y| + gamma_n ^ 2 * |x|^T |y|
+ */
+template<typename T>
+T Dot2(const T *x, const T *y, const indexType size) {
+
+    T sum[SummationLanes] = {}, error[SummationLanes] = {};
+
+    indexType i = 0;
+    for (; i + SummationLanes <= size; i += SummationLanes) {
+        for (indexType l = 0; l < SummationLanes; ++l) {
+            const ReturnStruct<T> p = TwoProductFMA(x[i + l], y[i + l]);
+            const ReturnStruct<T> s = TwoSum(sum[l], p.result);
+            sum[l] = s.result;
+            error[l] += s.error + p.error;
+        }
+    }
+
+    T total_sum = 0, total_error = 0;
+
+    for (; i < size; ++i) {
+        const ReturnStruct<T> p = TwoProductFMA(x[i], y[i]);
+        const ReturnStruct<T> s = TwoSum(total_sum, p.result);
+        total_sum = s.result;
+        total_error += s.error + p.error;
+    }
+
+    for (indexType l = 0; l < SummationLanes; ++l) {
+        const ReturnStruct<T> s = TwoSum(total_sum, sum[l]);
+        total_sum = s.result;
+        total_error += s.error + error[l];
+    }
+
+    return total_sum + total_error;
+}
+
+/**
+ * Dot product in K-fold working precision (Ogita, Rump, Oishi, DotK): the 2n exact parts of the products and
+ * of their cascaded sum are summed with SumK
+ * @tparam T floating point type
+ * @param x first vector
+ * @param y second vector
+ * @param size vector length
+ * @param K precision factor, K >= 2
+ * @return dot product, |result - x^T y| <= (u + 2 * gamma_{4n-2} ^ 2) * |x^T y| + gamma_{4n-2} ^ K * |x|^T |y|
+ */
+template<typename T>
+T DotK(const T *x, const T *y, const indexType size, const indexType K) {
+
+    if (size == 0) {
+        return 0;
+    }
+
+    std::vector<T> r(2 * size);
+
+    ReturnStruct<T> p = TwoProductFMA(x[0], y[0]);
+    r[0] = p.error;
+
+    for (indexType i = 1; i < size; ++i) {
+        const ReturnStruct<T> h = TwoProductFMA(x[i], y[i]);
+        const ReturnStruct<T> s = TwoSum(p.result, h.result);
+        p.result = s.result;
+        r[i] = h.error;
+        r[size + i - 1] = s.error;
+    }
+    r[2 * size - 1] = p.result;
+
+    return SumK(r.data(), r.size(), K - 1);
+}
+
+namespace Detail {
+
+    /**
+     * Computable bound from |result - s| <= c * |s| + e: since |s| <= |result| + |result - s|,
+     * |result - s| <= (c * |result| + e) / (1 - c)
+     */
+    template<typename T>
+    T PosterioriBound(const T &result, const T &relative, const T &absolute) {
+        return (relative * std::abs(result) + absolute) / (1 - relative);
+    }
+
+    template<typename T>
+    T AbsoluteSum(const T *values, const indexType size) {
+        T sum = 0;
+        for (indexType i = 0; i < size; ++i) {
+            sum += std::abs(values[i]);
+        }
+        return sum * (1 + Gamma<T>(size));
+    }
+
+    template<typename T>
+    T AbsoluteDot(const T *x, const T *y, const indexType size) {
+        T sum = 0;
+        for (indexType i = 0; i < size; ++i) {
+            sum += std::abs(x[i] * y[i]);
+        }
+        return sum * (1 + Gamma<T>(size + 1));
+    }
+
+    template<typename T>
+    T GammaPower(const T &gamma, const indexType K) {
+        T power = 1;
+        for (indexType k = 0; k < K; ++k) {
+            power *= gamma;
+        }
+        return power;
+    }
+}
+
+/**
+ * Sum2 with computable error bound
+ * @tparam T floating point type
+ * @param values summands
+ * @param size number of summands
+ * @return struct: sum and its error bound
+ */
+template<typename T>
+BoundStruct<T> Sum2WithBound(const T *values, const indexType size) {
+
+    const T gamma = Gamma<T>(size > 0 ? size - 1 : 0);
+
+    BoundStruct<T> out;
+    out.result = Sum2(values, size);
+    out.bound = Detail::PosterioriBound(out.result, UnitRoundoff<T>(),
+                                        gamma * gamma * Detail::AbsoluteSum(values, size));
+
+    return out;
+}
+
+/**
+ * SumK with computable error bound
+ * @tparam T floating point type
+ * @param values summands
+ * @param size number of summands
+ * @param K precision factor
+ * @return struct: sum and its error bound
+ */
+template<typename T>
+BoundStruct<T> SumKWithBound(const T *values, const indexType size, const indexType K) {
+
+    const T gamma = Gamma<T>(size > 0 ? size - 1 : 0);
+
+    BoundStruct<T> out;
+    out.result = SumK(values, size, K);
+    out.bound = Detail::PosterioriBound(out.result, UnitRoundoff<T>() + 3 * gamma * gamma,
+                                        Detail::GammaPower(Gamma<T>(size > 0 ? 2 * size - 2 : 0), K) *
+                                        Detail::AbsoluteSum(values, size));
+
+    return out;
+}
+
+/**
+ * Dot2 with computable error bound
+ * @tparam T floating point type
+ * @param x first vector
+ * @param y second vector
+ * @param size vector length
+ * @return struct: dot product and its error bound
+ */
+template<typename T>
+BoundStruct<T> Dot2WithBound(const T *x, const T *y, const indexType size) {
+
+    const T gamma = Gamma<T>(size);
+
+    BoundStruct<T> out;
+    out.result = Dot2(x, y, size);
+    out.bound = Detail::PosterioriBound(out.result, UnitRoundoff<T>(),
+                                        gamma * gamma * Detail::AbsoluteDot(x, y, size));
+
+    return out;
+}
+
+/**
+ * DotK with computable error bound
+ * @tparam T floating point type
+ * @param x first vector
+ * @param y second vector
+ * @param size vector length
+ * @param K precision factor
+ * @return struct: dot product and its error bound
+ */
+template<typename T>
+BoundStruct<T> DotKWithBound(const T *x, const T *y, const indexType size, const indexType K) {
+
+    const T gamma = Gamma<T>(size > 0 ? 4 * size - 2 : 0);
+
+    BoundStruct<T> out;
+    out.result = DotK(x, y, size, K);
+    out.bound = Detail::PosterioriBound(out.result, UnitRoundoff<T>() + 2 * gamma * gamma,
+                                        Detail::GammaPower(gamma, K) * Detail::AbsoluteDot(x, y, size));
+
+    return out;
+}
+
+#endif //POLYNOMEVALUATION_COMPENSATEDSUMMATION_H
@@ -0,0 +1,226 @@
+#ifndef POLYNOMEVALUATION_COMPLEXEVALUATION_H
+#define POLYNOMEVALUATION_COMPLEXEVALUATION_H
+
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+/**
+ * Number of points evaluated together by the batched complex kernels
+ */
+constexpr indexType ComplexBatchWidth = 8;
+
+template<typename T>
+struct ComplexProductStruct {
+    std::complex<T> result;
+    std::complex<T> error_first;
+    std::complex<T> error_second;
+    std::complex<T> error_third;
+};
+
+/**
+ * Error-free transformation of the product of 2 complex floating point numbers with FMA:
+ * a * b = result + error_first + error_second + error_third exactly.
+ * The sum of complex numbers needs no overload: TwoSum is exact componentwise
+ * @tparam T floating point type
+ * @param a complex floating point number
+ * @param b complex floating point number
+ * @return struct: result of a * b and three error terms
+ */
+template<typename T>
+ComplexProductStruct<T> TwoProductFMA(const std::complex<T> &a,
+                                      const std::complex<T> &b) {
+    ComplexProductStruct<T> out;
+
+    const ReturnStruct<T> real_real = TwoProductFMA(a.real(), b.real());
+    const ReturnStruct<T> imag_imag = TwoProductFMA(a.imag(), b.imag());
+    const ReturnStruct<T> real_imag = TwoProductFMA(a.real(), b.imag());
+    const ReturnStruct<T> imag_real = TwoProductFMA(a.imag(), b.real());
+
+    const ReturnStruct<T> real_sum = TwoSum(real_real.result, -imag_imag.result);
+    const ReturnStruct<T> imag_sum = TwoSum(real_imag.result, imag_real.result);
+
+    out.result = {real_sum.result, imag_sum.result};
+    out.error_first = {real_real.error, real_imag.error};
+    out.error_second = {-imag_imag.error, imag_real.error};
+    out.error_third = {real_sum.error, imag_sum.error};
+
+    return out;
+}
+
+/**
+ * Compensated Horner Scheme for complex coeffs and point
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with complex FP coeffs
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T, indexType N>
+std::complex<T> CompensatedHorner(const Polynom<std::complex<T>, N> &polynom, const std::complex<T> &x) {
+
+    Polynom<std::complex<T>, N - 1> polynom_error;
+
+    ComplexProductStruct<T> p;
+    ReturnStruct<std::complex<T>> s;
+    s.result = polynom[N];
+
+    for (indexType i = N; i >= 1; i--) {
+
+        p = TwoProductFMA(s.result, x);
+        s = TwoSum(p.result, polynom[i - 1]);
+
+        polynom_error[i - 1] = p.error_first + p.error_second + p.error_third + s.error;
+    }
+
+    return s.result + Horner(polynom_error, x);
+}
+
+/**
+ * Complex polynom with real and imaginary parts of the coeffs stored in separate arrays
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ */
+template<typename T, indexType N>
+class SplitComplexPolynom {
+
+private:
+    Containers::array<T, N + 1> real_;
+    Containers::array<T, N + 1> imag_;
+
+public:
+
+    constexpr SplitComplexPolynom() = default;
+
+    constexpr SplitComplexPolynom(const Containers::array<T, N + 1> &real,
+                                  const Containers::array<T, N + 1> &imag) noexcept: real_(real), imag_(imag) {}
+
+    constexpr SplitComplexPolynom(const Polynom<std::complex<T>, N> &polynom) noexcept {
+        for (indexType i = 0; i < N + 1; ++i) {
+            real_[i] = polynom[i].real();
+            imag_[i] = polynom[i].imag();
+        }
+    }
+
+    const T &Real(const indexType &i) const {
+        return real_[i];
+    }
+
+    const T &Imag(const indexType &i) const {
+        return imag_[i];
+    }
+};
+
+namespace Detail {
+
+    /**
+     * Compensated Horner for up to ComplexBatchWidth complex points, every step is a loop over the points
+     * @tparam T floating point type
+     * @tparam N polynom degree
+     * @param polynom split complex polynom
+     * @param x_real real parts of the points
+     * @param x_imag imaginary parts of the points
+     * @param size number of points, not greater than ComplexBatchWidth
+     * @param out_real real parts of the values
+     * @param out_imag imaginary parts of the values
+     */
+    template<typename T, indexType N>
+    void CompensatedHornerBlock(const SplitComplexPolynom<T, N> &polynom, const T *x_real, const T *x_imag,
+                                const indexType size, T *out_real, T *out_imag) {
+
+        T s_real[ComplexBatchWidth], s_imag[ComplexBatchWidth];
+        T c_real[ComplexBatchWidth], c_imag[ComplexBatchWidth];
+
+        for (indexType j = 0; j < size; ++j) {
+            s_real[j] = polynom.Real(N);
+            s_imag[j] = polynom.Imag(N);
+            c_real[j] = 0;
+            c_imag[j] = 0;
+        }
+
+        for (indexType i = N; i >= 1; i--) {
+            const T a_real = polynom.Real(i - 1);
+            const T a_imag = polynom.Imag(i - 1);
+
+            for (indexType j = 0; j < size; ++j) {
+                const ReturnStruct<T> real_real = TwoProductFMA(s_real[j], x_real[j]);
+                const ReturnStruct<T> imag_imag = TwoProductFMA(s_imag[j], x_imag[j]);
+                const ReturnStruct<T> real_imag = TwoProductFMA(s_real[j], x_imag[j]);
+                const ReturnStruct<T> imag_real = TwoProductFMA(s_imag[j], x_real[j]);
+
+                const ReturnStruct<T> real_product = TwoSum(real_real.result, -imag_imag.result);
+                const ReturnStruct<T> imag_product = TwoSum(real_imag.result, imag_real.result);
+
+                const ReturnStruct<T> real_sum = TwoSum(real_product.result, a_real);
+                const ReturnStruct<T> imag_sum = TwoSum(imag_product.result, a_imag);
+
+                const T error_real = real_real.error - imag_imag.error + real_product.error + real_sum.error;
+                const T error_imag = real_imag.error + imag_real.error + imag_product.error + imag_sum.error;
+
+                const T c_real_next = c_real[j] * x_real[j] - c_imag[j] * x_imag[j] + error_real;
+                c_imag[j] = c_real[j] * x_imag[j] + c_imag[j] * x_real[j] + error_imag;
+                c_real[j] = c_real_next;
+
+                s_real[j] = real_sum.result;
+                s_imag[j] = imag_sum.result;
+            }
+        }
+
+        for (indexType j = 0; j < size; ++j) {
+            out_real[j] = s_real[j] + c_real[j];
+            out_imag[j] = s_imag[j] + c_imag[j];
+        }
+    }
+}
+
+/**
+ * Batched compensated Horner scheme for complex points in split real/imag layout
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom split complex polynom
+ * @param x_real real parts of the points
+ * @param x_imag imaginary parts of the points
+ * @param size number of points
+ * @param out_real real parts of the polynom values
+ * @param out_imag imaginary parts of the polynom values
+ */
+template<typename T, indexType N>
+void CompensatedHornerBatch(const SplitComplexPolynom<T, N> &polynom, const T *x_real, const T *x_imag,
+                            const indexType size, T *out_real, T *out_imag) {
+
+    for (indexType begin = 0; begin < size; begin += ComplexBatchWidth) {
+        const indexType block_size = std::min(ComplexBatchWidth, size - begin);
+        Detail::CompensatedHornerBlock(polynom, x_real + begin, x_imag + begin, block_size,
+                                       out_real + begin, out_imag + begin);
+    }
+}
+
+/**
+ * Compensated Horner scheme in the roots of unity exp(2 * pi * i * k / size), k = 0, ..., size - 1.
+ * The points are the rounded values of cos and sin
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom split complex polynom
+ * @param size number of points on the unit circle
+ * @param out_real real parts of the polynom values
+ * @param out_imag imaginary parts of the polynom values
+ */
+template<typename T, indexType N>
+void CompensatedHornerUnitCircle(const SplitComplexPolynom<T, N> &polynom, const indexType size,
+                                 T *out_real, T *out_imag) {
+
+    std::vector<T> x_real(size), x_imag(size);
+
+    for (indexType k = 0; k < size; ++k) {
+        const T angle = 2 * std::numbers::pi_v<T> * static_cast<T>(k) / static_cast<T>(size);
+        x_real[k] = std::cos(angle);
+        x_imag[k] = std::sin(angle);
+    }
+
+    CompensatedHornerBatch(polynom, x_real.data(), x_imag.data(), size, out_real, out_imag);
+}
+
+#endif //POLYNOMEVALUATION_COMPLEXEVALUATION_H
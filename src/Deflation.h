@@ -0,0 +1,82 @@
+#ifndef POLYNOMEVALUATION_DEFLATION_H
+#define POLYNOMEVALUATION_DEFLATION_H
+
+#include "PolynomEvaluation.h"
+
+/**
+ * Result of the division by (x - r): p(x) = (x - r) * (quotient(x) + correction(x)) + remainder
+ * up to second order terms, the correction holds the rounding errors of the quotient coeffs
+ */
+template<typename T, indexType N>
+struct DeflationStruct {
+    Polynom<T, N> quotient;
+    Polynom<T, N> correction;
+    T remainder;
+};
+
+/**
+ * Compensated synthetic division of p + c by (x - r). The quotient coeffs are the sums of CompensatedHorner in r,
+ * its errors pi_i + sigma_i form the polynom E with p(x) = (x - r) * quotient(x) + s_0 + E(x) exactly.
+ * E + c is divided by (x - r) in working precision into the correction, its remainder completes s_0,
+ * so the remainder equals CompensatedHorner(p, r) for c = 0 when both are compiled without contraction,
+ * otherwise it stays within the bound of CompensatedHornerWithBound.
+ * Repeated deflation passes the pair on, the roots of quotient + correction keep the accuracy of p + c
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param correction correction of the polynom from an earlier deflation
+ * @param r divisor root
+ * @return struct: quotient, its correction and the remainder
+ */
+template<typename T, indexType N>
+DeflationStruct<T, N - 1> Deflate(const Polynom<T, N> &polynom, const Polynom<T, N> &correction, const T &r) {
+
+    static_assert(N >= 1, "deflation of a constant");
+
+    DeflationStruct<T, N - 1> out;
+    Polynom<T, N> error;
+
+    ReturnStruct<T> p, s;
+    s.result = polynom[N];
+    error[N] = correction[N];
+
+    for (indexType i = N; i >= 1; i--) {
+        out.quotient[i - 1] = s.result;
+
+        p = TwoProductFMA(s.result, r);
+        s = TwoSum(p.result, polynom[i - 1]);
+
+        error[i - 1] = (p.error + s.error) + correction[i - 1];
+    }
+
+    T sum = error[N];
+    for (indexType i = N; i >= 1; i--) {
+        out.correction[i - 1] = sum;
+        sum = sum * r + error[i - 1];
+    }
+
+    out.remainder = s.result + sum;
+
+    return out;
+}
+
+/**
+ * Compensated synthetic division of p by (x - r), see Deflate with correction
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param r divisor root
+ * @return struct: quotient, its correction and the remainder
+ */
+template<typename T, indexType N>
+DeflationStruct<T, N - 1> Deflate(const Polynom<T, N> &polynom, const T &r) {
+
+    Polynom<T, N> correction;
+    for (indexType i = 0; i < N + 1; ++i) {
+        correction[i] = T(0);
+    }
+
+    return Deflate(polynom, correction, r);
+}
+
+#endif //POLYNOMEVALUATION_DEFLATION_H
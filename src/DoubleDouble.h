@@ -0,0 +1,93 @@
+#ifndef POLYNOMEVALUATION_DOUBLEDOUBLE_H
+#define POLYNOMEVALUATION_DOUBLEDOUBLE_H
+
+#include "PolynomEvaluation.h"
+
+/**
+ * Unevaluated sum hi + lo with |lo| <= ulp(hi) / 2, about twice the precision of T
+ * @tparam T floating point type
+ */
+template<typename T>
+struct DoubleDouble {
+    T hi;
+    T lo;
+};
+
+/**
+ * Double-double numbers: bounds are expressed in T. The unit roundoff covers the relative error 3 * u ^ 2
+ * of the double-double operations, the relative error model breaks down once lo underflows
+ * @tparam T floating point type of the components
+ */
+template<typename T>
+struct FloatTraits<DoubleDouble<T>> {
+
+    using real = T;
+
+    static constexpr int digits = 2 * FloatTraits<T>::digits;
+
+    static constexpr real unit_roundoff = 4 * FloatTraits<T>::unit_roundoff * FloatTraits<T>::unit_roundoff;
+
+    static constexpr real underflow = FloatTraits<T>::underflow / FloatTraits<T>::unit_roundoff;
+
+    static constexpr real denorm = FloatTraits<T>::denorm;
+
+    static constexpr bool has_fma = false;
+
+    static constexpr real Gamma(const std::size_t &n) {
+        const real nu = static_cast<real>(n) * unit_roundoff;
+        return nu / (1 - nu);
+    }
+};
+
+/**
+ * Product of double-double and floating point number, relative error about 2 * u ^ 2
+ * @tparam T floating point type
+ * @param a double-double number
+ * @param b floating point number
+ * @return normalized double-double product
+ */
+template<typename T>
+DoubleDouble<T> operator*(const DoubleDouble<T> &a, const T &b) {
+
+    const ReturnStruct<T> p = TwoProductFMA(a.hi, b);
+    const ReturnStruct<T> s = FastTwoSum(p.result, p.error + a.lo * b);
+
+    return {s.result, s.error};
+}
+
+/**
+ * Product of two double-double numbers, relative error about 4 * u ^ 2
+ * @tparam T floating point type
+ * @param a double-double number
+ * @param b double-double number
+ * @return normalized double-double product
+ */
+template<typename T>
+DoubleDouble<T> operator*(const DoubleDouble<T> &a, const DoubleDouble<T> &b) {
+
+    const ReturnStruct<T> p = TwoProductFMA(a.hi, b.hi);
+    const ReturnStruct<T> s = FastTwoSum(p.result, p.error + (a.hi * b.lo + a.lo * b.hi));
+
+    return {s.result, s.error};
+}
+
+/**
+ * Sum of two double-double numbers, the low parts are added with TwoSum as well,
+ * so the relative error stays about 3 * u ^ 2 even under cancellation
+ * @tparam T floating point type
+ * @param a double-double number
+ * @param b double-double number
+ * @return normalized double-double sum
+ */
+template<typename T>
+DoubleDouble<T> operator+(const DoubleDouble<T> &a, const DoubleDouble<T> &b) {
+
+    const ReturnStruct<T> s = TwoSum(a.hi, b.hi);
+    const ReturnStruct<T> t = TwoSum(a.lo, b.lo);
+    const ReturnStruct<T> v = FastTwoSum(s.result, s.error + t.result);
+    const ReturnStruct<T> w = FastTwoSum(v.result, v.error + t.error);
+
+    return {w.result, w.error};
+}
+
+#endif //POLYNOMEVALUATION_DOUBLEDOUBLE_H
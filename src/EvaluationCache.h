@@ -0,0 +1,322 @@
+#ifndef POLYNOMEVALUATION_EVALUATIONCACHE_H
+#define POLYNOMEVALUATION_EVALUATIONCACHE_H
+
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+/**
+ * Default number of shards of EvaluationCache, every shard has its own writer mutex and counters
+ */
+constexpr indexType EvaluationCacheShards = 16;
+
+/**
+ * Number of slots a key may occupy in its shard
+ */
+constexpr indexType EvaluationCacheWays = 4;
+
+namespace Detail {
+
+    template<typename T>
+    std::uint64_t CacheBits(const T &value) {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(std::uint64_t),
+                      "cached type must fit into 64 bits");
+
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        return bits;
+    }
+
+    template<typename T>
+    T CacheValue(const std::uint64_t &bits) {
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+
+    /**
+     * Finalizer of splitmix64, spreads the key over shards and buckets
+     */
+    inline std::uint64_t CacheMix(std::uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+        return value ^ (value >> 31);
+    }
+}
+
+/**
+ * Identity of the polynom for cache keys: FNV-1a hash of the degree and of the bit patterns of the coeffs.
+ * Computing it costs a pass over the coeffs, so callers evaluating one polynom many times should keep it
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @return 64-bit identity
+ */
+template<typename T, indexType N>
+std::uint64_t PolynomIdentity(const Polynom<T, N> &polynom) {
+
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+
+    auto add = [&hash](const std::uint64_t &bits) {
+        for (indexType byte = 0; byte < sizeof(std::uint64_t); ++byte) {
+            hash ^= (bits >> (8 * byte)) & 0xff;
+            hash *= 0x100000001b3ull;
+        }
+    };
+
+    add(N);
+    for (indexType i = 0; i < N + 1; ++i) {
+        add(Detail::CacheBits(polynom[i]));
+    }
+
+    return hash;
+}
+
+/**
+ * Bounded memoization of polynom values keyed on the polynom identity and the bit pattern of x.
+ * The cache is split into shards of EvaluationCacheWays-way buckets. Readers never lock: every slot is
+ * a seqlock of atomic words, a torn read is reported as a miss. Writers take the mutex of the shard
+ * and replace slots in CLOCK order, hits set the reference bit of the slot (approximate LRU)
+ * @tparam T floating point type, at most 64 bits wide
+ */
+template<typename T>
+class EvaluationCache {
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<std::uint64_t> polynom{0};
+        std::atomic<std::uint64_t> x{0};
+        std::atomic<std::uint64_t> value{0};
+        std::atomic<bool> referenced{false};
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unique_ptr<Slot[]> slots;
+        indexType hand = 0;
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+    };
+
+    indexType buckets_ = 0;
+    indexType shards_ = 0;
+    std::unique_ptr<Shard[]> shard_;
+
+    std::uint64_t Key(const std::uint64_t &polynom, const std::uint64_t &x) const {
+        return Detail::CacheMix(polynom ^ Detail::CacheMix(x));
+    }
+
+    Shard &ShardOf(const std::uint64_t &key) const {
+        return shard_[key % shards_];
+    }
+
+    Slot *BucketOf(const Shard &shard, const std::uint64_t &key) const {
+        return shard.slots.get() + ((key / shards_) % buckets_) * EvaluationCacheWays;
+    }
+
+    static bool Read(const Slot &slot, const std::uint64_t &polynom, const std::uint64_t &x, std::uint64_t &value) {
+
+        const std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before == 0 || (before & 1) != 0) {
+            return false;
+        }
+
+        const bool match = slot.polynom.load(std::memory_order_relaxed) == polynom &&
+                           slot.x.load(std::memory_order_relaxed) == x;
+        value = slot.value.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return match && slot.sequence.load(std::memory_order_relaxed) == before;
+    }
+
+    static void Write(Slot &slot, const std::uint64_t &polynom, const std::uint64_t &x, const std::uint64_t &value) {
+
+        const std::uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+
+        slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.polynom.store(polynom, std::memory_order_relaxed);
+        slot.x.store(x, std::memory_order_relaxed);
+        slot.value.store(value, std::memory_order_relaxed);
+
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+public:
+
+    /**
+     * @param capacity maximal number of cached values, rounded up to whole buckets in every shard
+     * @param shards number of shards
+     */
+    explicit EvaluationCache(const indexType capacity, const indexType shards = EvaluationCacheShards) :
+            shards_(std::max<indexType>(shards, 1)) {
+
+        buckets_ = std::max<indexType>((capacity + shards_ * EvaluationCacheWays - 1) /
+                                       (shards_ * EvaluationCacheWays), 1);
+
+        shard_ = std::make_unique<Shard[]>(shards_);
+        for (indexType i = 0; i < shards_; ++i) {
+            shard_[i].slots = std::make_unique<Slot[]>(buckets_ * EvaluationCacheWays);
+        }
+    }
+
+    EvaluationCache(const EvaluationCache &) = delete;
+
+    EvaluationCache &operator=(const EvaluationCache &) = delete;
+
+    indexType Capacity() const {
+        return shards_ * buckets_ * EvaluationCacheWays;
+    }
+
+    /**
+     * Lock-free lookup
+     * @param polynom identity of the polynom
+     * @param x point
+     * @param value cached value, set on hit
+     * @return true on hit
+     */
+    bool Find(const std::uint64_t &polynom, const T &x, T &value) const {
+
+        const std::uint64_t x_bits = Detail::CacheBits(x);
+        const std::uint64_t key = Key(polynom, x_bits);
+
+        Shard &shard = ShardOf(key);
+        Slot *bucket = BucketOf(shard, key);
+
+        for (indexType way = 0; way < EvaluationCacheWays; ++way) {
+            std::uint64_t bits;
+            if (Read(bucket[way], polynom, x_bits, bits)) {
+                if (!bucket[way].referenced.load(std::memory_order_relaxed)) {
+                    bucket[way].referenced.store(true, std::memory_order_relaxed);
+                }
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                value = Detail::CacheValue<T>(bits);
+                return true;
+            }
+        }
+
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * Stores the value, evicting an unreferenced slot of the bucket if it is full
+     * @param polynom identity of the polynom
+     * @param x point
+     * @param value polynom value in point x
+     */
+    void Insert(const std::uint64_t &polynom, const T &x, const T &value) {
+
+        const std::uint64_t x_bits = Detail::CacheBits(x);
+        const std::uint64_t key = Key(polynom, x_bits);
+
+        Shard &shard = ShardOf(key);
+        Slot *bucket = BucketOf(shard, key);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        Slot *victim = nullptr;
+
+        for (indexType way = 0; way < EvaluationCacheWays && victim == nullptr; ++way) {
+            const Slot &slot = bucket[way];
+            if (slot.sequence.load(std::memory_order_relaxed) == 0 ||
+                (slot.polynom.load(std::memory_order_relaxed) == polynom &&
+                 slot.x.load(std::memory_order_relaxed) == x_bits)) {
+                victim = &bucket[way];
+            }
+        }
+
+        // CLOCK sweep: the second round finds a slot whose reference bit was cleared by the first one,
+        // unless concurrent hits set it again, then the slot under the hand is evicted
+        for (indexType step = 0; step < 2 * EvaluationCacheWays && victim == nullptr; ++step) {
+            Slot &slot = bucket[shard.hand++ % EvaluationCacheWays];
+            if (!slot.referenced.exchange(false, std::memory_order_relaxed)) {
+                victim = &slot;
+            }
+        }
+
+        if (victim == nullptr) {
+            victim = &bucket[shard.hand++ % EvaluationCacheWays];
+        }
+
+        Write(*victim, polynom, x_bits, Detail::CacheBits(value));
+        victim->referenced.store(false, std::memory_order_relaxed);
+    }
+
+    std::uint64_t Hits() const {
+        std::uint64_t hits = 0;
+        for (indexType i = 0; i < shards_; ++i) {
+            hits += shard_[i].hits.load(std::memory_order_relaxed);
+        }
+        return hits;
+    }
+
+    std::uint64_t Misses() const {
+        std::uint64_t misses = 0;
+        for (indexType i = 0; i < shards_; ++i) {
+            misses += shard_[i].misses.load(std::memory_order_relaxed);
+        }
+        return misses;
+    }
+
+    double HitRate() const {
+        const std::uint64_t hits = Hits(), total = hits + Misses();
+        return total == 0 ? 0. : static_cast<double>(hits) / static_cast<double>(total);
+    }
+
+    void ResetCounters() {
+        for (indexType i = 0; i < shards_; ++i) {
+            shard_[i].hits.store(0, std::memory_order_relaxed);
+            shard_[i].misses.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * Compensated Horner scheme memoized in the cache
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param identity PolynomIdentity of the polynom
+ * @param x value for polynom calculation
+ * @param cache evaluation cache
+ * @return polynom value in point x, equal to CompensatedHorner(polynom, x)
+ */
+template<typename T, indexType N>
+T CachedCompensatedHorner(const Polynom<T, N> &polynom, const std::uint64_t &identity, const T &x,
+                          EvaluationCache<T> &cache) {
+
+    T value;
+    if (cache.Find(identity, x, value)) {
+        return value;
+    }
+
+    value = CompensatedHorner(polynom, x);
+    cache.Insert(identity, x, value);
+
+    return value;
+}
+
+/**
+ * Compensated Horner scheme memoized in the cache, the identity is recomputed on every call
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @param cache evaluation cache
+ * @return polynom value in point x, equal to CompensatedHorner(polynom, x)
+ */
+template<typename T, indexType N>
+T CachedCompensatedHorner(const Polynom<T, N> &polynom, const T &x, EvaluationCache<T> &cache) {
+    return CachedCompensatedHorner(polynom, PolynomIdentity(polynom), x, cache);
+}
+
+#endif //POLYNOMEVALUATION_EVALUATIONCACHE_H
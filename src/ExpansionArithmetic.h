@@ -0,0 +1,332 @@
+#ifndef POLYNOMEVALUATION_EXPANSIONARITHMETIC_H
+#define POLYNOMEVALUATION_EXPANSIONARITHMETIC_H
+
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+/**
+ * Floating point expansion (Shewchuk): exact value is the sum of the components,
+ * components are nonoverlapping and sorted by increasing magnitude, zero components are eliminated
+ */
+template<typename T>
+using Expansion = std::vector<T>;
+
+/**
+ * Exact sum of expansion and floating point number (Grow-Expansion with zero elimination)
+ * @tparam T floating point type
+ * @param e expansion
+ * @param b floating point number
+ * @param out expansion e + b, must not alias e
+ */
+template<typename T>
+void GrowExpansion(const Expansion<T> &e, const T &b, Expansion<T> &out) {
+
+    out.clear();
+    T q = b;
+
+    for (const T &component: e) {
+        const ReturnStruct<T> s = TwoSum(q, component);
+        q = s.result;
+        if (s.error != 0) {
+            out.push_back(s.error);
+        }
+    }
+
+    if (q != 0 || out.empty()) {
+        out.push_back(q);
+    }
+}
+
+/**
+ * Exact product of expansion and floating point number (Scale-Expansion with zero elimination)
+ * @tparam T floating point type
+ * @param e expansion
+ * @param b floating point number
+ * @param out expansion e * b, must not alias e
+ */
+template<typename T>
+void ScaleExpansion(const Expansion<T> &e, const T &b, Expansion<T> &out) {
+
+    out.clear();
+    if (e.empty()) {
+        out.push_back(0);
+        return;
+    }
+
+    ReturnStruct<T> p = TwoProductFMA(e[0], b);
+    T q = p.result;
+    if (p.error != 0) {
+        out.push_back(p.error);
+    }
+
+    for (indexType i = 1; i < e.size(); ++i) {
+        p = TwoProductFMA(e[i], b);
+
+        const ReturnStruct<T> s = TwoSum(q, p.error);
+        if (s.error != 0) {
+            out.push_back(s.error);
+        }
+
+        const ReturnStruct<T> t = TwoSum(p.result, s.result);
+        q = t.result;
+        if (t.error != 0) {
+            out.push_back(t.error);
+        }
+    }
+
+    if (q != 0 || out.empty()) {
+        out.push_back(q);
+    }
+}
+
+/**
+ * Exact sum of two expansions (Expansion-Sum)
+ * @tparam T floating point type
+ * @param e expansion
+ * @param f expansion
+ * @return expansion e + f
+ */
+template<typename T>
+Expansion<T> ExpansionSum(const Expansion<T> &e, const Expansion<T> &f) {
+
+    Expansion<T> out(e), buffer;
+
+    for (const T &component: f) {
+        GrowExpansion(out, component, buffer);
+        out.swap(buffer);
+    }
+
+    return out;
+}
+
+/**
+ * Exact product of two expansions
+ * @tparam T floating point type
+ * @param e expansion
+ * @param f expansion
+ * @return expansion e * f
+ */
+template<typename T>
+Expansion<T> ExpansionProduct(const Expansion<T> &e, const Expansion<T> &f) {
+
+    Expansion<T> out = {0}, scaled;
+
+    for (const T &component: f) {
+        ScaleExpansion(e, component, scaled);
+        out = ExpansionSum(out, scaled);
+    }
+
+    return out;
+}
+
+/**
+ * Compression of the expansion (Shewchuk's Compress): same value with fewer components,
+ * the largest component approximates the value with relative error below 2u
+ * @tparam T floating point type
+ * @param e expansion, compressed in place
+ */
+template<typename T>
+void CompressExpansion(Expansion<T> &e) {
+
+    if (e.size() < 2) {
+        return;
+    }
+
+    Expansion<T> g(e.size());
+    indexType bottom = e.size() - 1;
+    T q = e[bottom];
+
+    for (indexType i = e.size() - 1; i >= 1; i--) {
+        const ReturnStruct<T> s = TwoSum(q, e[i - 1]);
+        if (s.error != 0) {
+            g[bottom--] = s.result;
+            q = s.error;
+        } else {
+            q = s.result;
+        }
+    }
+    g[bottom] = q;
+
+    indexType top = 0;
+    for (indexType i = bottom + 1; i < e.size(); ++i) {
+        const ReturnStruct<T> s = TwoSum(g[i], q);
+        q = s.result;
+        if (s.error != 0) {
+            e[top++] = s.error;
+        }
+    }
+    e[top++] = q;
+    e.resize(top);
+}
+
+/**
+ * Sign of the exact value of the expansion
+ * @tparam T floating point type
+ * @param e expansion
+ * @return -1, 0 or 1
+ */
+template<typename T>
+int ExpansionSign(const Expansion<T> &e) {
+
+    for (indexType i = e.size(); i >= 1; i--) {
+        if (e[i - 1] != 0) {
+            return e[i - 1] > 0 ? 1 : -1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Faithful approximation of the expansion: components summed from the smallest
+ * @tparam T floating point type
+ * @param e expansion
+ * @return approximate value
+ */
+template<typename T>
+T ExpansionEstimate(const Expansion<T> &e) {
+
+    T sum = 0;
+    for (const T &component: e) {
+        sum += component;
+    }
+
+    return sum;
+}
+
+/**
+ * Rounding of the exact value of the expansion to nearest, ties to even (gradual underflow aside)
+ * @tparam T floating point type
+ * @param e expansion
+ * @return correctly rounded value
+ */
+template<typename T>
+T ExpansionRound(const Expansion<T> &e) {
+
+    T result = ExpansionEstimate(e);
+    Expansion<T> difference, remainder;
+
+    while (std::isfinite(result)) {
+
+        GrowExpansion(e, -result, difference);
+        const int direction = ExpansionSign(difference);
+        if (direction == 0) {
+            break;
+        }
+
+        const T neighbour = std::nextafter(result, direction * std::numeric_limits<T>::infinity());
+        const T half_gap = (neighbour - result) / 2;
+
+        GrowExpansion(difference, -half_gap, remainder);
+        const int comparison = ExpansionSign(remainder) * direction;
+
+        if (comparison > 0) {
+            result = neighbour;
+            continue;
+        }
+
+        if (comparison == 0) {
+            int exponent;
+            const T mantissa = std::frexp(result, &exponent);
+            const T last_bit = std::ldexp(mantissa, FloatTraits<T>::digits);
+            if (std::fmod(last_bit, T(2)) != 0) {
+                result = neighbour;
+            }
+        }
+        break;
+    }
+
+    return result;
+}
+
+/**
+ * Exact Horner scheme in expansion arithmetic: every step s * x + a is computed without rounding
+ * @tparam T floating point type
+ * @param polynom view of FP coeffs
+ * @param x value for polynom calculation
+ * @return expansion equal to the exact polynom value in point x
+ */
+template<typename T>
+Expansion<T> ExactHorner(const PolynomView<T> &polynom, const T &x) {
+
+    Expansion<T> sum = {polynom[polynom.Degree()]}, buffer;
+
+    for (indexType i = polynom.Degree(); i >= 1; i--) {
+        ScaleExpansion(sum, x, buffer);
+        GrowExpansion(buffer, polynom[i - 1], sum);
+        CompressExpansion(sum);
+    }
+
+    return sum;
+}
+
+/**
+ * Exact Horner scheme in expansion arithmetic
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @return expansion equal to the exact polynom value in point x
+ */
+template<typename T, indexType N>
+Expansion<T> ExactHorner(const Polynom<T, N> &polynom, const T &x) {
+    return ExactHorner(PolynomView<T>(polynom), x);
+}
+
+/**
+ * Correctly rounded reference value of the polynom
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @return exact polynom value in point x rounded to nearest
+ */
+template<typename T, indexType N>
+T ReferenceHorner(const Polynom<T, N> &polynom, const T &x) {
+    return ExpansionRound(ExactHorner(polynom, x));
+}
+
+/**
+ * Correctly rounded reference values for many points, the points are split between threads
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out reference polynom values
+ * @param threads number of threads, 0 means hardware concurrency
+ */
+template<typename T, indexType N>
+void ReferenceHornerBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out,
+                          indexType threads = 0) {
+
+    if (threads == 0) {
+        threads = std::max<indexType>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::min(threads, std::max<indexType>(size, 1));
+
+    auto worker = [&](const indexType begin, const indexType end) {
+        for (indexType i = begin; i < end; ++i) {
+            out[i] = ReferenceHorner(polynom, x[i]);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    const indexType part = (size + threads - 1) / threads;
+
+    for (indexType t = 1; t < threads; ++t) {
+        pool.emplace_back(worker, std::min(t * part, size), std::min((t + 1) * part, size));
+    }
+    worker(0, std::min(part, size));
+
+    for (auto &thread: pool) {
+        thread.join();
+    }
+}
+
+#endif //POLYNOMEVALUATION_EXPANSIONARITHMETIC_H
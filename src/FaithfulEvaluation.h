@@ -0,0 +1,116 @@
+#ifndef POLYNOMEVALUATION_FAITHFULEVALUATION_H
+#define POLYNOMEVALUATION_FAITHFULEVALUATION_H
+
+#include "ExpansionArithmetic.h"
+#include "PolynomEvaluation.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/**
+ * Counters of FaithfulHorner calls and of the calls escalated to expansion arithmetic
+ */
+struct FaithfulHornerCounters {
+    std::atomic<std::uint64_t> evaluations{0};
+    std::atomic<std::uint64_t> escalations{0};
+
+    double EscalationRate() const {
+        const std::uint64_t total = evaluations.load(std::memory_order_relaxed);
+        return total == 0 ? 0. : static_cast<double>(escalations.load(std::memory_order_relaxed)) /
+                                 static_cast<double>(total);
+    }
+
+    void Reset() {
+        evaluations.store(0, std::memory_order_relaxed);
+        escalations.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Process-wide counters used by FaithfulHorner by default
+ * @return reference to the counters
+ */
+inline FaithfulHornerCounters &GetFaithfulHornerCounters() {
+    static FaithfulHornerCounters counters;
+    return counters;
+}
+
+/**
+ * Certification of faithful rounding: if |result - p(x)| <= bound and the bound is smaller than the distance
+ * to both floating point neighbours of result, then p(x) lies strictly between them and result is faithful
+ * @tparam T floating point type
+ * @param value compensated result and its error bound
+ * @return true if the result is certainly faithfully rounded
+ */
+template<typename T>
+bool IsFaithful(const BoundStruct<T> &value) {
+
+    if (!std::isfinite(value.result) || !std::isfinite(value.bound)) {
+        return false;
+    }
+
+    const T below = value.result - std::nextafter(value.result, -std::numeric_limits<T>::infinity());
+    const T above = std::nextafter(value.result, std::numeric_limits<T>::infinity()) - value.result;
+
+    return value.bound < below && value.bound < above;
+}
+
+/**
+ * Faithfully rounded Horner scheme: compensated Horner is certified by its a posteriori bound
+ * and only the points that fail the certification are recomputed exactly in expansion arithmetic
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @param counters counters of evaluations and escalations
+ * @return faithfully rounded polynom value in point x
+ */
+template<typename T, indexType N>
+T FaithfulHorner(const Polynom<T, N> &polynom, const T &x,
+                 FaithfulHornerCounters &counters = GetFaithfulHornerCounters()) {
+
+    counters.evaluations.fetch_add(1, std::memory_order_relaxed);
+
+    const BoundStruct<T> value = CompensatedHornerWithBound(polynom, x);
+    if (IsFaithful(value)) {
+        return value.result;
+    }
+
+    counters.escalations.fetch_add(1, std::memory_order_relaxed);
+
+    return ReferenceHorner(polynom, x);
+}
+
+/**
+ * Faithfully rounded Horner scheme for many points, counters are updated once per batch
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out faithfully rounded polynom values
+ * @param counters counters of evaluations and escalations
+ */
+template<typename T, indexType N>
+void FaithfulHornerBatch(const Polynom<T, N> &polynom, const T *x, const indexType size, T *out,
+                         FaithfulHornerCounters &counters = GetFaithfulHornerCounters()) {
+
+    std::uint64_t escalations = 0;
+
+    for (indexType i = 0; i < size; ++i) {
+        const BoundStruct<T> value = CompensatedHornerWithBound(polynom, x[i]);
+        if (IsFaithful(value)) {
+            out[i] = value.result;
+        } else {
+            out[i] = ReferenceHorner(polynom, x[i]);
+            ++escalations;
+        }
+    }
+
+    counters.evaluations.fetch_add(size, std::memory_order_relaxed);
+    counters.escalations.fetch_add(escalations, std::memory_order_relaxed);
+}
+
+#endif //POLYNOMEVALUATION_FAITHFULEVALUATION_H
@@ -0,0 +1,114 @@
+#ifndef POLYNOMEVALUATION_FLOATTRAITS_H
+#define POLYNOMEVALUATION_FLOATTRAITS_H
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace Detail {
+
+    /**
+     * Whether the compiler reports fma of the type as fast: __FP_FAST_FMAF, __FP_FAST_FMA and __FP_FAST_FMAL
+     * describe float, double and long double separately. Without it std::fma is a software routine of libm
+     */
+    template<typename T>
+    constexpr bool FastFMA() {
+        if constexpr (std::is_same_v<T, float>) {
+#if defined(__FP_FAST_FMAF)
+            return true;
+#endif
+        } else if constexpr (std::is_same_v<T, double>) {
+#if defined(__FP_FAST_FMA)
+            return true;
+#endif
+        } else if constexpr (std::is_same_v<T, long double>) {
+#if defined(__FP_FAST_FMAL)
+            return true;
+#endif
+        }
+        return false;
+    }
+}
+
+/**
+ * Constants of the rounding error analysis of the floating point type, standard types take them
+ * from std::numeric_limits. Bounds are expressed in the type real
+ * @tparam T floating point type
+ */
+template<typename T>
+struct FloatTraits {
+
+    static_assert(std::numeric_limits<T>::is_specialized && !std::numeric_limits<T>::is_integer,
+                  "FloatTraits requires a floating point type");
+
+    using real = T;
+
+    // mantissa bits including the implicit one
+    static constexpr int digits = std::numeric_limits<T>::digits;
+
+    // u = epsilon / 2
+    static constexpr real unit_roundoff = std::numeric_limits<T>::epsilon() / 2;
+
+    // smallest normalized number: below it the relative error model does not hold
+    static constexpr real underflow = std::numeric_limits<T>::min();
+
+    // smallest subnormal number, absolute error of a product in gradual underflow is below it / 2
+    static constexpr real denorm = std::numeric_limits<T>::denorm_min();
+
+    // the target has a fast fma for the type, TwoProductFMA falls back to Dekker's product otherwise
+    static constexpr bool has_fma = Detail::FastFMA<T>();
+
+    /**
+     * @param n number of operations
+     * @return gamma_n = n * u / (1 - n * u)
+     */
+    static constexpr real Gamma(const std::size_t &n) {
+        const real nu = static_cast<real>(n) * unit_roundoff;
+        return nu / (1 - nu);
+    }
+};
+
+namespace Detail {
+
+    template<typename T>
+    constexpr T PowerOfTwo(int exponent) {
+        T result = 1, base = exponent < 0 ? T(0.5) : T(2);
+        for (exponent = exponent < 0 ? -exponent : exponent; exponent > 0; exponent /= 2) {
+            if (exponent % 2 != 0) {
+                result *= base;
+            }
+            base *= base;
+        }
+        return result;
+    }
+}
+
+#ifdef __SIZEOF_FLOAT128__
+
+/**
+ * IEEE binary128, std::numeric_limits is not specialized for it and there is no std::fma overload
+ */
+template<>
+struct FloatTraits<__float128> {
+
+    using real = __float128;
+
+    static constexpr int digits = 113;
+
+    static constexpr real unit_roundoff = Detail::PowerOfTwo<__float128>(-113);
+
+    static constexpr real underflow = Detail::PowerOfTwo<__float128>(-16382);
+
+    static constexpr real denorm = Detail::PowerOfTwo<__float128>(-16494);
+
+    static constexpr bool has_fma = false;
+
+    static constexpr real Gamma(const std::size_t &n) {
+        const real nu = static_cast<real>(n) * unit_roundoff;
+        return nu / (1 - nu);
+    }
+};
+
+#endif
+
+#endif //POLYNOMEVALUATION_FLOATTRAITS_H
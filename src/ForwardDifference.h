@@ -0,0 +1,149 @@
+#ifndef POLYNOMEVALUATION_FORWARDDIFFERENCE_H
+#define POLYNOMEVALUATION_FORWARDDIFFERENCE_H
+
+#include "DoubleDouble.h"
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Detail {
+
+    template<typename T>
+    struct ForwardDifferenceSeed {
+        BoundStruct<T> value;
+        DoubleDouble<T> table_value;
+        T table_bound;
+    };
+
+    /**
+     * Compensated Horner scheme keeping the unrounded sum of result and correction: the pair is exact up to
+     * the gamma_{4N+2} part of the bound of CompensatedHornerWithBound, the rounded value gets the full bound
+     */
+    template<typename T, indexType N>
+    ForwardDifferenceSeed<T> SeedForwardDifference(const Polynom<T, N> &polynom, const T &x) {
+
+        ForwardDifferenceSeed<T> out;
+
+        if constexpr (N == 0) {
+            out.value = {polynom[0], 0};
+            out.table_value = {polynom[0], 0};
+            out.table_bound = 0;
+        } else {
+            ReturnStruct<T> p, s;
+            s.result = polynom[N];
+            T error = 0, abs_error = 0;
+
+            for (indexType i = N; i >= 1; i--) {
+
+                p = TwoProductFMA(s.result, x);
+                s = TwoSum(p.result, polynom[i - 1]);
+
+                error = error * x + (p.error + s.error);
+                abs_error = abs_error * std::abs(x) + (std::abs(p.error) + std::abs(s.error));
+            }
+
+            const T u = UnitRoundoff<T>();
+            const ReturnStruct<T> sum = TwoSum(s.result, error);
+            const T abs_result = std::abs(sum.result);
+
+            out.value.result = sum.result;
+            out.table_value = {sum.result, sum.error};
+            out.table_bound = (Gamma<T>(4 * N + 2) * abs_error + 2 * u * u * abs_result) / (1 - 2 * (N + 1) * u);
+            out.value.bound = (u * abs_result + (Gamma<T>(4 * N + 2) * abs_error + 2 * u * u * abs_result)) /
+                              (1 - 2 * (N + 1) * u);
+        }
+
+        return out;
+    }
+}
+
+/**
+ * Polynom values in equally spaced points x0 + i * h by forward differencing.
+ * N + 1 consecutive points are evaluated with compensated Horner scheme, the difference table of the unrounded
+ * values is kept in double-double form and every further point costs N double-double additions built on TwoSum.
+ * The error bound of every table entry is propagated through the additions, the table is re-seeded
+ * from the current point as soon as the bound of the value exceeds the tolerance.
+ * Points are computed as x0 + i * h, so for exact sweeps x0 and h should be dyadic (e.g. h = 2 ^ -10)
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x0 first point
+ * @param h step
+ * @param size number of points
+ * @param tolerance absolute error allowed before re-seeding
+ * @param out polynom values
+ * @param bound error bounds of the values, may be nullptr
+ * @return number of seedings
+ */
+template<typename T, indexType N>
+indexType ForwardDifferenceHorner(const Polynom<T, N> &polynom, const T &x0, const T &h, const indexType size,
+                                  const T &tolerance, T *out, T *bound = nullptr) {
+
+    const T u = UnitRoundoff<T>();
+    const T rounding = 4 * u * u;
+
+    std::array<DoubleDouble<T>, N + 1> table;
+    std::array<T, N + 1> error;
+
+    indexType i = 0, seeds = 0;
+
+    while (i < size) {
+
+        const indexType count = std::min<indexType>(N + 1, size - i);
+
+        for (indexType j = 0; j < count; ++j) {
+            const Detail::ForwardDifferenceSeed<T> seed = Detail::SeedForwardDifference(
+                    polynom, x0 + static_cast<T>(i + j) * h);
+
+            out[i + j] = seed.value.result;
+            if (bound != nullptr) {
+                bound[i + j] = seed.value.bound;
+            }
+
+            table[j] = seed.table_value;
+            error[j] = seed.table_bound;
+        }
+
+        ++seeds;
+        i += count;
+
+        if (count < N + 1) {
+            break;
+        }
+
+        // after the pass k the entry N - k holds the backward difference of order k in the last seeded point
+        for (indexType k = 1; k < N + 1; ++k) {
+            for (indexType j = 0; j + k < N + 1; ++j) {
+                error[j] = (error[j] + error[j + 1]) +
+                           rounding * (std::abs(table[j].hi) + std::abs(table[j + 1].hi));
+                table[j] = table[j + 1] + DoubleDouble<T>{-table[j].hi, -table[j].lo};
+            }
+        }
+        std::reverse(table.begin(), table.end());
+        std::reverse(error.begin(), error.end());
+
+        for (; i < size; ++i) {
+
+            for (indexType k = N; k >= 1; k--) {
+                error[k - 1] = (error[k - 1] + error[k]) +
+                               rounding * (std::abs(table[k - 1].hi) + std::abs(table[k].hi));
+                table[k - 1] = table[k - 1] + table[k];
+            }
+
+            if (error[0] > tolerance) {
+                break;
+            }
+
+            out[i] = table[0].hi;
+            if (bound != nullptr) {
+                bound[i] = (std::abs(table[0].lo) + error[0]) * (1 + 2 * u);
+            }
+        }
+    }
+
+    return seeds;
+}
+
+#endif //POLYNOMEVALUATION_FORWARDDIFFERENCE_H
@@ -0,0 +1,152 @@
+#ifndef POLYNOMEVALUATION_INTERVALEVALUATION_H
+#define POLYNOMEVALUATION_INTERVALEVALUATION_H
+
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/**
+ * Number of points evaluated together by the batched interval kernel
+ */
+constexpr indexType IntervalBatchWidth = 8;
+
+template<typename T>
+struct Interval {
+    T lo;
+    T hi;
+};
+
+namespace Detail {
+
+    /**
+     * Rounding of the exact value result + error towards -infinity
+     */
+    template<typename T>
+    T RoundDown(const ReturnStruct<T> &value) {
+        return value.error < 0 ? std::nextafter(value.result, -std::numeric_limits<T>::infinity()) : value.result;
+    }
+
+    /**
+     * Rounding of the exact value result + error towards +infinity
+     */
+    template<typename T>
+    T RoundUp(const ReturnStruct<T> &value) {
+        return value.error > 0 ? std::nextafter(value.result, std::numeric_limits<T>::infinity()) : value.result;
+    }
+}
+
+/**
+ * Horner scheme in interval arithmetic. Directed rounding of every operation is derived from the sign of its exact
+ * error given by TwoProductFMA and TwoSum, so the floating point rounding mode is never switched.
+ * The result encloses the exact value of the polynom with FP coeffs in the FP point x (overflow aside)
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @return interval that contains the polynom value in point x
+ */
+template<typename T, indexType N>
+Interval<T> IntervalHorner(const Polynom<T, N> &polynom, const T &x) {
+
+    Interval<T> sum{polynom[N], polynom[N]};
+
+    for (indexType i = N; i >= 1; i--) {
+
+        const T &low_factor = x >= 0 ? sum.lo : sum.hi;
+        const T &high_factor = x >= 0 ? sum.hi : sum.lo;
+
+        const T product_lo = Detail::RoundDown(TwoProductFMA(low_factor, x));
+        const T product_hi = Detail::RoundUp(TwoProductFMA(high_factor, x));
+
+        sum.lo = Detail::RoundDown(TwoSum(product_lo, polynom[i - 1]));
+        sum.hi = Detail::RoundUp(TwoSum(product_hi, polynom[i - 1]));
+    }
+
+    return sum;
+}
+
+/**
+ * Enclosure from the compensated Horner scheme and its a posteriori error bound: [result - bound, result + bound]
+ * with outward rounding. Much tighter than IntervalHorner for ill-conditioned points, underflow is not taken into account
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @return interval that contains the polynom value in point x
+ */
+template<typename T, indexType N>
+Interval<T> CompensatedIntervalHorner(const Polynom<T, N> &polynom, const T &x) {
+
+    const BoundStruct<T> value = CompensatedHornerWithBound(polynom, x);
+
+    return {Detail::RoundDown(TwoSum(value.result, -value.bound)),
+            Detail::RoundUp(TwoSum(value.result, value.bound))};
+}
+
+namespace Detail {
+
+    /**
+     * CompensatedIntervalHorner for up to IntervalBatchWidth points, every step is a loop over the points
+     */
+    template<typename T, indexType N>
+    void CompensatedIntervalHornerBlock(const Polynom<T, N> &polynom, const T *x, const indexType size,
+                                        Interval<T> *out) {
+
+        T sum[IntervalBatchWidth], error[IntervalBatchWidth], abs_error[IntervalBatchWidth];
+
+        for (indexType j = 0; j < size; ++j) {
+            sum[j] = polynom[N];
+            error[j] = 0;
+            abs_error[j] = 0;
+        }
+
+        for (indexType i = N; i >= 1; i--) {
+            for (indexType j = 0; j < size; ++j) {
+
+                const ReturnStruct<T> p = TwoProductFMA(sum[j], x[j]);
+                const ReturnStruct<T> s = TwoSum(p.result, polynom[i - 1]);
+
+                sum[j] = s.result;
+                error[j] = error[j] * x[j] + (p.error + s.error);
+                abs_error[j] = abs_error[j] * std::abs(x[j]) + (std::abs(p.error) + std::abs(s.error));
+            }
+        }
+
+        const T u = UnitRoundoff<T>();
+        const T gamma = Gamma<T>(4 * N + 2);
+
+        for (indexType j = 0; j < size; ++j) {
+
+            const T result = sum[j] + error[j];
+            const T abs_result = std::abs(result);
+            const T bound = (u * abs_result + (gamma * abs_error[j] + 2 * u * u * abs_result)) /
+                            (1 - 2 * (N + 1) * u);
+
+            out[j] = {RoundDown(TwoSum(result, -bound)), RoundUp(TwoSum(result, bound))};
+        }
+    }
+}
+
+/**
+ * Batched CompensatedIntervalHorner: points are processed in blocks with the loop over points innermost,
+ * so the error-free transformations of independent points vectorize. Results are identical to the scalar version
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out intervals that contain the polynom values
+ */
+template<typename T, indexType N>
+void CompensatedIntervalHornerBatch(const Polynom<T, N> &polynom, const T *x, const indexType size,
+                                    Interval<T> *out) {
+
+    for (indexType begin = 0; begin < size; begin += IntervalBatchWidth) {
+        const indexType block_size = std::min(IntervalBatchWidth, size - begin);
+        Detail::CompensatedIntervalHornerBlock(polynom, x + begin, block_size, out + begin);
+    }
+}
+
+#endif //POLYNOMEVALUATION_INTERVALEVALUATION_H
@@ -0,0 +1,163 @@
+#ifndef POLYNOMEVALUATION_MAPPEDFILE_H
+#define POLYNOMEVALUATION_MAPPEDFILE_H
+
+#include "PolynomEvaluation.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <utility>
+
+/**
+ * Read-only or read-write memory mapping of a whole file (POSIX)
+ */
+class MappedFile {
+
+private:
+    int descriptor_ = -1;
+    void *data_ = nullptr;
+    indexType size_ = 0;
+
+    /**
+     * Releases what the constructor acquired so far and throws, the destructor does not run for it
+     */
+    [[noreturn]] void ThrowSystemError(const std::string &what) {
+        const int error = errno;
+        Release();
+        throw std::system_error(error, std::generic_category(), what);
+    }
+
+    void Release() {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+        }
+        if (descriptor_ >= 0) {
+            ::close(descriptor_);
+            descriptor_ = -1;
+        }
+    }
+
+public:
+
+    MappedFile() = default;
+
+    /**
+     * Maps an existing file for reading
+     * @param path path to the file
+     */
+    explicit MappedFile(const std::string &path) {
+
+        descriptor_ = ::open(path.c_str(), O_RDONLY);
+        if (descriptor_ < 0) {
+            ThrowSystemError("open " + path);
+        }
+
+        struct stat status{};
+        if (::fstat(descriptor_, &status) != 0) {
+            ThrowSystemError("fstat " + path);
+        }
+        size_ = static_cast<indexType>(status.st_size);
+
+        if (size_ > 0) {
+            data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor_, 0);
+            if (data_ == MAP_FAILED) {
+                data_ = nullptr;
+                ThrowSystemError("mmap " + path);
+            }
+        }
+    }
+
+    /**
+     * Creates (or truncates) a file of the given size and maps it for writing
+     * @param path path to the file
+     * @param size file size in bytes
+     */
+    MappedFile(const std::string &path, const indexType size) : size_(size) {
+
+        descriptor_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (descriptor_ < 0) {
+            ThrowSystemError("open " + path);
+        }
+
+        if (::ftruncate(descriptor_, static_cast<off_t>(size_)) != 0) {
+            ThrowSystemError("ftruncate " + path);
+        }
+
+        if (size_ > 0) {
+            data_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor_, 0);
+            if (data_ == MAP_FAILED) {
+                data_ = nullptr;
+                ThrowSystemError("mmap " + path);
+            }
+        }
+    }
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept
+            : descriptor_(std::exchange(other.descriptor_, -1)), data_(std::exchange(other.data_, nullptr)),
+              size_(std::exchange(other.size_, 0)) {}
+
+    MappedFile &operator=(MappedFile &&other) noexcept {
+        std::swap(descriptor_, other.descriptor_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+
+    ~MappedFile() {
+        Release();
+    }
+
+    const void *Data() const {
+        return data_;
+    }
+
+    void *Data() {
+        return data_;
+    }
+
+    indexType Size() const {
+        return size_;
+    }
+
+    /**
+     * Kernel hint for the byte range [begin, end) of the mapping, the range is widened to whole pages
+     * @param begin first byte
+     * @param end byte after the last one
+     * @param advice madvise advice
+     */
+    void Advise(const indexType begin, const indexType end, const int advice) const {
+        if (data_ == nullptr || begin >= std::min(end, size_)) {
+            return;
+        }
+        const indexType page = static_cast<indexType>(::sysconf(_SC_PAGESIZE));
+        const indexType aligned_begin = begin / page * page;
+        ::madvise(static_cast<char *>(data_) + aligned_begin, std::min(end, size_) - aligned_begin, advice);
+    }
+
+    /**
+     * Starts asynchronous write back of the byte range [begin, end), the range is widened to whole pages
+     * @param begin first byte
+     * @param end byte after the last one
+     */
+    void FlushAsync(const indexType begin, const indexType end) const {
+        if (data_ == nullptr || begin >= std::min(end, size_)) {
+            return;
+        }
+        const indexType page = static_cast<indexType>(::sysconf(_SC_PAGESIZE));
+        const indexType aligned_begin = begin / page * page;
+        ::msync(static_cast<char *>(data_) + aligned_begin, std::min(end, size_) - aligned_begin, MS_ASYNC);
+    }
+};
+
+#endif //POLYNOMEVALUATION_MAPPEDFILE_H
@@ -0,0 +1,285 @@
+#ifndef POLYNOMEVALUATION_MULTIVARIATEEVALUATION_H
+#define POLYNOMEVALUATION_MULTIVARIATEEVALUATION_H
+
+#include "PolynomEvaluation.h"
+
+#include <vector>
+
+/**
+ * Multivariate polynom p(x_0, ..., x_{D-1}) = sum of c[i_0]...[i_{D-1}] * x_0 ^ i_0 * ... * x_{D-1} ^ i_{D-1}.
+ * Coeffs are stored row-major, so the coeffs of the last variable are contiguous
+ * and the innermost Horner runs over contiguous memory
+ * @tparam T floating point type
+ * @tparam N degrees in every variable
+ */
+template<typename T, indexType... N>
+class MultiPolynom {
+
+public:
+    static constexpr indexType Dimension = sizeof...(N);
+    static constexpr indexType Size = ((N + 1) * ...);
+    static constexpr Containers::array<indexType, Dimension> Degrees = {N...};
+
+private:
+    Containers::array<T, Size> data_;
+
+public:
+
+    constexpr MultiPolynom() = default;
+
+    constexpr MultiPolynom(const Containers::array<T, Size> &coeffs) noexcept: data_(coeffs) {}
+
+    const T &operator[](const indexType &i) const {
+        return data_[i];
+    }
+
+    T &operator[](const indexType &i) {
+        return data_[i];
+    }
+
+    /**
+     * Coefficient access by powers of the variables
+     * @param powers power of every variable
+     * @return reference to the coefficient
+     */
+    T &operator()(const Containers::array<indexType, Dimension> &powers) {
+        return data_[Index(powers)];
+    }
+
+    const T &operator()(const Containers::array<indexType, Dimension> &powers) const {
+        return data_[Index(powers)];
+    }
+
+    /**
+     * Position of the coefficient in the row-major storage
+     * @param powers power of every variable
+     * @return index of the coefficient
+     */
+    static constexpr indexType Index(const Containers::array<indexType, Dimension> &powers) {
+        indexType index = 0;
+        for (indexType d = 0; d < Dimension; ++d) {
+            index = index * (Degrees[d] + 1) + powers[d];
+        }
+        return index;
+    }
+
+    const T *Data() const {
+        return data_.data();
+    }
+};
+
+namespace Detail {
+
+    /**
+     * Number of coeffs that belong to one coefficient of variable Level
+     */
+    template<indexType Level, indexType... N>
+    constexpr indexType MultiPolynomStride() {
+        constexpr Containers::array<indexType, sizeof...(N)> degrees = {N...};
+        indexType stride = 1;
+        for (indexType d = Level + 1; d < sizeof...(N); ++d) {
+            stride *= degrees[d] + 1;
+        }
+        return stride;
+    }
+
+    /**
+     * Nested compensated Horner on variables Level, ..., D - 1.
+     * Values of the inner levels come as unevaluated sums result + error and the errors enter the correction
+     * @return struct: compensated value and its correction term
+     */
+    template<indexType Level, typename T, indexType... N>
+    ReturnStruct<T> MultiCompensatedHorner(const T *data, const Containers::array<T, sizeof...(N)> &x) {
+
+        constexpr Containers::array<indexType, sizeof...(N)> degrees = {N...};
+        constexpr indexType degree = degrees[Level];
+        constexpr indexType stride = MultiPolynomStride<Level, N...>();
+
+        auto coefficient = [&](const indexType &i) {
+            if constexpr (Level + 1 == sizeof...(N)) {
+                return ReturnStruct<T>{data[i], T(0)};
+            } else {
+                return MultiCompensatedHorner<Level + 1, T, N...>(data + i * stride, x);
+            }
+        };
+
+        ReturnStruct<T> out = coefficient(degree);
+        ReturnStruct<T> p, s;
+
+        for (indexType i = degree; i >= 1; i--) {
+            const ReturnStruct<T> a = coefficient(i - 1);
+
+            p = TwoProductFMA(out.result, x[Level]);
+            s = TwoSum(p.result, a.result);
+
+            out.result = s.result;
+            out.error = out.error * x[Level] + (p.error + s.error + a.error);
+        }
+
+        return out;
+    }
+
+    /**
+     * Nested Horner on variables Level, ..., D - 1, optionally with absolute values of coeffs
+     */
+    template<indexType Level, bool Absolute, typename T, indexType... N>
+    T MultiHorner(const T *data, const Containers::array<T, sizeof...(N)> &x) {
+
+        constexpr Containers::array<indexType, sizeof...(N)> degrees = {N...};
+        constexpr indexType degree = degrees[Level];
+        constexpr indexType stride = MultiPolynomStride<Level, N...>();
+
+        auto coefficient = [&](const indexType &i) {
+            if constexpr (Level + 1 == sizeof...(N)) {
+                return Absolute ? std::abs(data[i]) : data[i];
+            } else {
+                return MultiHorner<Level + 1, Absolute, T, N...>(data + i * stride, x);
+            }
+        };
+
+        T sum = coefficient(degree);
+
+        for (indexType i = degree; i >= 1; i--) {
+            sum = sum * x[Level] + coefficient(i - 1);
+        }
+
+        return sum;
+    }
+}
+
+/**
+ * Nested Horner scheme for multivariate polynom
+ * @tparam T floating point type
+ * @tparam N degrees in every variable
+ * @param polynom multivariate polynom with FP coeffs
+ * @param x point for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T, indexType... N>
+T Horner(const MultiPolynom<T, N...> &polynom, const Containers::array<T, sizeof...(N)> &x) {
+    return Detail::MultiHorner<0, false, T, N...>(polynom.Data(), x);
+}
+
+/**
+ * Nested compensated Horner scheme for multivariate polynom
+ * @tparam T floating point type
+ * @tparam N degrees in every variable
+ * @param polynom multivariate polynom with FP coeffs
+ * @param x point for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T, indexType... N>
+T CompensatedHorner(const MultiPolynom<T, N...> &polynom, const Containers::array<T, sizeof...(N)> &x) {
+
+    const ReturnStruct<T> out = Detail::MultiCompensatedHorner<0, T, N...>(polynom.Data(), x);
+
+    return out.result + out.error;
+}
+
+/**
+ * Nested compensated Horner scheme with a priori error bound
+ * |result - p(x)| <= u * |result| + gamma_{4K+2} ^ 2 * p~(|x|), where K is the sum of the degrees
+ * and p~ is the polynom with absolute values of the coeffs
+ * @tparam T floating point type
+ * @tparam N degrees in every variable
+ * @param polynom multivariate polynom with FP coeffs
+ * @param x point for polynom calculation
+ * @return struct: polynom value in point x and its error bound
+ */
+template<typename T, indexType... N>
+BoundStruct<T> CompensatedHornerWithBound(const MultiPolynom<T, N...> &polynom,
+                                          const Containers::array<T, sizeof...(N)> &x) {
+
+    constexpr indexType total_degree = (N + ...);
+
+    Containers::array<T, sizeof...(N)> x_abs;
+    for (indexType d = 0; d < sizeof...(N); ++d) {
+        x_abs[d] = std::abs(x[d]);
+    }
+
+    BoundStruct<T> out;
+    out.result = CompensatedHorner(polynom, x);
+
+    const T gamma = Gamma<T>(4 * total_degree + 2);
+    out.bound = UnitRoundoff<T>() * std::abs(out.result) +
+                gamma * gamma * Detail::MultiHorner<0, true, T, N...>(polynom.Data(), x_abs);
+
+    return out;
+}
+
+/**
+ * Nested compensated Horner scheme on the cartesian grid of points.
+ * Variables are eliminated from the last one: the partial values of every row are computed once per grid value
+ * and reused for all values of the other variables, the innermost loop runs over contiguous grid points.
+ * Results are identical to CompensatedHorner in every grid point
+ * @tparam T floating point type
+ * @tparam N degrees in every variable
+ * @param polynom multivariate polynom with FP coeffs
+ * @param grids grid values of every variable
+ * @param sizes number of grid values of every variable
+ * @param out polynom values, row-major with the last variable contiguous
+ */
+template<typename T, indexType... N>
+void CompensatedHornerGrid(const MultiPolynom<T, N...> &polynom,
+                           const Containers::array<const T *, sizeof...(N)> &grids,
+                           const Containers::array<indexType, sizeof...(N)> &sizes, T *out) {
+
+    constexpr indexType dimension = sizeof...(N);
+    constexpr Containers::array<indexType, dimension> degrees = {N...};
+
+    std::vector<T> value(polynom.Data(), polynom.Data() + MultiPolynom<T, N...>::Size);
+    std::vector<T> error(value.size(), T(0));
+
+    indexType prefix_size = MultiPolynom<T, N...>::Size;
+    indexType suffix_size = 1;
+
+    for (indexType level = dimension; level >= 1; level--) {
+
+        const indexType d = level - 1;
+        const indexType degree = degrees[d];
+        prefix_size /= degree + 1;
+
+        std::vector<T> next_value(prefix_size * sizes[d] * suffix_size);
+        std::vector<T> next_error(next_value.size());
+
+        ReturnStruct<T> p, s;
+
+        for (indexType prefix = 0; prefix < prefix_size; ++prefix) {
+            for (indexType point = 0; point < sizes[d]; ++point) {
+
+                const T x = grids[d][point];
+                T *result_value = next_value.data() + (prefix * sizes[d] + point) * suffix_size;
+                T *result_error = next_error.data() + (prefix * sizes[d] + point) * suffix_size;
+                const T *coeff_value = value.data() + prefix * (degree + 1) * suffix_size;
+                const T *coeff_error = error.data() + prefix * (degree + 1) * suffix_size;
+
+                for (indexType suffix = 0; suffix < suffix_size; ++suffix) {
+                    result_value[suffix] = coeff_value[degree * suffix_size + suffix];
+                    result_error[suffix] = coeff_error[degree * suffix_size + suffix];
+                }
+
+                for (indexType i = degree; i >= 1; i--) {
+                    for (indexType suffix = 0; suffix < suffix_size; ++suffix) {
+
+                        p = TwoProductFMA(result_value[suffix], x);
+                        s = TwoSum(p.result, coeff_value[(i - 1) * suffix_size + suffix]);
+
+                        result_value[suffix] = s.result;
+                        result_error[suffix] = result_error[suffix] * x +
+                                               (p.error + s.error + coeff_error[(i - 1) * suffix_size + suffix]);
+                    }
+                }
+            }
+        }
+
+        value.swap(next_value);
+        error.swap(next_error);
+        suffix_size *= sizes[d];
+    }
+
+    for (indexType i = 0; i < value.size(); ++i) {
+        out[i] = value[i] + error[i];
+    }
+}
+
+#endif //POLYNOMEVALUATION_MULTIVARIATEEVALUATION_H
@@ -0,0 +1,229 @@
+#ifndef POLYNOMEVALUATION_NEWTONFORMPOLYNOM_H
+#define POLYNOMEVALUATION_NEWTONFORMPOLYNOM_H
+
+#include "PolynomEvaluation.h"
+
+#include <cmath>
+
+/**
+ * Number of points evaluated together by the batched Newton form kernels
+ */
+constexpr indexType NewtonBatchWidth = 8;
+
+/**
+ * Polynom in Newton form: p(x) = c_0 + (x - x_0) * (c_1 + (x - x_1) * (c_2 + ... + (x - x_{N-1}) * c_N))
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ */
+template<typename T, indexType N>
+class NewtonFormPolynom {
+
+private:
+    Containers::array<T, N> nodes_;
+    Containers::array<T, N + 1> data_;
+
+public:
+
+    constexpr NewtonFormPolynom() = default;
+
+    constexpr NewtonFormPolynom(const Containers::array<T, N> &nodes, const Containers::array<T, N + 1> &coeffs) noexcept
+            : nodes_(nodes), data_(coeffs) {}
+
+    /**
+     * Interpolant through (x_i, y_i), the coeffs are the divided differences y[x_0, ..., x_i]
+     * @param x pairwise different nodes
+     * @param y values in the nodes
+     * @return interpolating polynom, the last node is not needed for evaluation
+     */
+    static NewtonFormPolynom FromSamples(const Containers::array<T, N + 1> &x, const Containers::array<T, N + 1> &y) {
+
+        NewtonFormPolynom<T, N> out;
+        out.data_ = y;
+
+        for (indexType j = 1; j < N + 1; ++j) {
+            for (indexType i = N; i >= j; i--) {
+                out.data_[i] = (out.data_[i] - out.data_[i - 1]) / (x[i] - x[i - j]);
+            }
+        }
+
+        for (indexType i = 0; i < N; ++i) {
+            out.nodes_[i] = x[i];
+        }
+
+        return out;
+    }
+
+    const T &Node(const indexType &i) const {
+        return nodes_[i];
+    }
+
+    T &Node(const indexType &i) {
+        return nodes_[i];
+    }
+
+    const T &operator[](const indexType &i) const {
+        return data_[i];
+    }
+
+    T &operator[](const indexType &i) {
+        return data_[i];
+    }
+};
+
+/**
+ * Nested multiplication
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom in Newton form
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T, indexType N>
+T Horner(const NewtonFormPolynom<T, N> &polynom, const T &x) {
+
+    T s = polynom[N];
+    for (indexType i = N; i >= 1; i--) {
+        s = s * (x - polynom.Node(i - 1)) + polynom[i - 1];
+    }
+
+    return s;
+}
+
+namespace Detail {
+
+    /**
+     * Compensated nested multiplication for Width points: x - x_i = d + delta exactly, so every step
+     * s * (x - x_i) + c_i leaves the exact error pi + sigma + s * delta, which is accumulated as in CompensatedHorner.
+     * The differences are computed once per node and point and feed both the sum and the correction
+     */
+    template<bool WithBound, indexType Width, typename T, indexType N>
+    [[gnu::always_inline]] inline void CompensatedNewtonBlock(const NewtonFormPolynom<T, N> &polynom, const T *x,
+                                                              T *out, T *bound) {
+
+        T s[Width], e[Width], abs_e[Width];
+
+        for (indexType k = 0; k < Width; ++k) {
+            s[k] = polynom[N];
+            e[k] = 0;
+            abs_e[k] = 0;
+        }
+
+        for (indexType i = N; i >= 1; i--) {
+            const T node = polynom.Node(i - 1);
+            const T c = polynom[i - 1];
+
+            for (indexType k = 0; k < Width; ++k) {
+
+                const ReturnStruct<T> d = TwoSum(x[k], -node);
+                const ReturnStruct<T> p = TwoProductFMA(s[k], d.result);
+                const ReturnStruct<T> t = TwoSum(p.result, c);
+
+                const T shift = s[k] * d.error;
+
+                e[k] = e[k] * d.result + ((p.error + t.error) + shift);
+
+                if constexpr (WithBound) {
+                    abs_e[k] = abs_e[k] * std::abs(d.result) +
+                               ((std::abs(p.error) + std::abs(t.error)) + std::abs(shift));
+                }
+
+                s[k] = t.result;
+            }
+        }
+
+        for (indexType k = 0; k < Width; ++k) {
+            out[k] = s[k] + e[k];
+        }
+
+        if constexpr (WithBound) {
+            const T u = UnitRoundoff<T>();
+
+            for (indexType k = 0; k < Width; ++k) {
+                const T abs_result = std::abs(out[k]);
+                bound[k] = (u * abs_result + (Gamma<T>(4 * N + 4) * abs_e[k] + 2 * u * u * abs_result)) /
+                           (1 - 2 * (N + 1) * u);
+            }
+        }
+    }
+
+    template<bool WithBound, typename T, indexType N>
+    void CompensatedNewtonKernel(const NewtonFormPolynom<T, N> &polynom, const T *x, const indexType size,
+                                 T *out, T *bound) {
+        indexType begin = 0;
+
+        for (; begin + NewtonBatchWidth <= size; begin += NewtonBatchWidth) {
+            CompensatedNewtonBlock<WithBound, NewtonBatchWidth>(polynom, x + begin, out + begin,
+                                                                 WithBound ? bound + begin : bound);
+        }
+
+        for (; begin < size; ++begin) {
+            CompensatedNewtonBlock<WithBound, 1>(polynom, x + begin, out + begin, WithBound ? bound + begin : bound);
+        }
+    }
+}
+
+/**
+ * Compensated nested multiplication, as accurate as nested multiplication in twice the working precision
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom in Newton form
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T, indexType N>
+T CompensatedHorner(const NewtonFormPolynom<T, N> &polynom, const T &x) {
+    T out;
+    Detail::CompensatedNewtonBlock<false, 1>(polynom, &x, &out, static_cast<T *>(nullptr));
+    return out;
+}
+
+/**
+ * Compensated nested multiplication with a posteriori error bound, as CompensatedHornerWithBound:
+ * |result - p(x)| <= (u * |result| + gamma_{4N+4} * E + 2 * u ^ 2 * |result|) / (1 - 2 * (N + 1) * u)
+ * where E is the nested multiplication of |pi| + |sigma| + |s * delta| with |x - x_i|, the two extra
+ * gamma terms cover the rounding of s * delta and of the differences. Underflow is not taken into account
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom in Newton form
+ * @param x value for polynom calculation
+ * @return struct: polynom value in point x and its error bound
+ */
+template<typename T, indexType N>
+BoundStruct<T> CompensatedHornerWithBound(const NewtonFormPolynom<T, N> &polynom, const T &x) {
+    BoundStruct<T> out;
+    Detail::CompensatedNewtonBlock<true, 1>(polynom, &x, &out.result, &out.bound);
+    return out;
+}
+
+/**
+ * Compensated nested multiplication for many points, NewtonBatchWidth at a time: every node and coeff
+ * is loaded once per block. Results are equal to CompensatedHorner
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom in Newton form
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out polynom values
+ */
+template<typename T, indexType N>
+void CompensatedHornerBatch(const NewtonFormPolynom<T, N> &polynom, const T *x, const indexType size, T *out) {
+    Detail::CompensatedNewtonKernel<false>(polynom, x, size, out, static_cast<T *>(nullptr));
+}
+
+/**
+ * Compensated nested multiplication with error bounds for many points
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom in Newton form
+ * @param x values for polynom calculation
+ * @param size number of points
+ * @param out polynom values
+ * @param bound error bounds of the values
+ */
+template<typename T, indexType N>
+void CompensatedHornerWithBoundBatch(const NewtonFormPolynom<T, N> &polynom, const T *x, const indexType size,
+                                     T *out, T *bound) {
+    Detail::CompensatedNewtonKernel<true>(polynom, x, size, out, bound);
+}
+
+#endif //POLYNOMEVALUATION_NEWTONFORMPOLYNOM_H
@@ -0,0 +1,62 @@
+#ifndef POLYNOMEVALUATION_PARALLELEVALUATION_H
+#define POLYNOMEVALUATION_PARALLELEVALUATION_H
+
+#include "BatchEvaluation.h"
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <execution>
+#include <type_traits>
+
+/**
+ * Polynom values for a range of points with a standard execution policy, a drop-in for std::transform pipelines.
+ * Every point is evaluated independently by Horner or CompensatedHorner, so the results do not depend
+ * on the policy. Parallel policies of libstdc++ run on TBB, which is linked when it is found
+ * @tparam ExecutionPolicy std::execution policy type
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param policy execution policy
+ * @param polynom polynom with FP coeffs
+ * @param first beginning of the points
+ * @param last end of the points
+ * @param out beginning of the values
+ * @param kernel evaluation algorithm
+ * @return end of the values
+ */
+template<typename ExecutionPolicy, typename T, indexType N, typename ForwardIt, typename OutputIt,
+        typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+OutputIt EvaluateRange(ExecutionPolicy &&policy, const Polynom<T, N> &polynom, ForwardIt first, ForwardIt last,
+                       OutputIt out, const Kernel &kernel = Kernel::Compensated) {
+
+    if (kernel == Kernel::Horner) {
+        return std::transform(std::forward<ExecutionPolicy>(policy), first, last, out,
+                              [&polynom](const T &x) { return Horner(polynom, x); });
+    }
+
+    return std::transform(std::forward<ExecutionPolicy>(policy), first, last, out,
+                          [&polynom](const T &x) { return CompensatedHorner(polynom, x); });
+}
+
+/**
+ * Polynom values for a range of points, sequential
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param first beginning of the points
+ * @param last end of the points
+ * @param out beginning of the values
+ * @param kernel evaluation algorithm
+ * @return end of the values
+ */
+template<typename T, indexType N, typename InputIt, typename OutputIt>
+OutputIt EvaluateRange(const Polynom<T, N> &polynom, InputIt first, InputIt last, OutputIt out,
+                       const Kernel &kernel = Kernel::Compensated) {
+
+    if (kernel == Kernel::Horner) {
+        return std::transform(first, last, out, [&polynom](const T &x) { return Horner(polynom, x); });
+    }
+
+    return std::transform(first, last, out, [&polynom](const T &x) { return CompensatedHorner(polynom, x); });
+}
+
+#endif //POLYNOMEVALUATION_PARALLELEVALUATION_H
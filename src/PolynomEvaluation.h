@@ -1,12 +1,26 @@
 #ifndef POLYNOMEVALUATION_POLYNOM_H
 #define POLYNOMEVALUATION_POLYNOM_H
 
+#include "FloatTraits.h"
+
 #include <array>
 #include <cmath>
+#include <limits>
 
 using indexType = std::size_t;
 using scalar = double;
 
+/**
+ * Functions whose rounding must not change are compiled without contraction of a * b + c: builds for FMA targets
+ * would fuse Veltkamp's split, Dekker's product and the kernels without FMA otherwise. Without FMA in the target
+ * nothing can be fused and the attribute is left out, so these functions are still inlined
+ */
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__FMA__) || defined(__FP_FAST_FMA))
+#define POLYNOMEVALUATION_NO_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+#define POLYNOMEVALUATION_NO_CONTRACT
+#endif
+
 /*** Функцию для подсчета ***/
 
 namespace Containers {
@@ -46,12 +60,72 @@ public:
     }
 };
 
+/**
+ * Non-owning view of polynom coeffs with runtime degree, e.g. coeffs stored in a mapped file
+ * @tparam T floating point type
+ */
+template<typename T>
+class PolynomView {
+
+private:
+    const T *data_ = nullptr;
+    indexType degree_ = 0;
+
+public:
+
+    constexpr PolynomView() = default;
+
+    constexpr PolynomView(const T *coeffs, const indexType &degree) noexcept: data_(coeffs), degree_(degree) {}
+
+    template<indexType N>
+    constexpr PolynomView(const Polynom<T, N> &polynom) noexcept : data_(&polynom[0]), degree_(N) {}
+
+    const T &operator[](const indexType &i) const {
+        return data_[i];
+    }
+
+    const T *Data() const {
+        return data_;
+    }
+
+    indexType Degree() const {
+        return degree_;
+    }
+};
+
 template<typename T>
 struct ReturnStruct {
     T result;
     T error;
 };
 
+template<typename T>
+struct BoundStruct {
+    T result;
+    T bound;
+};
+
+/**
+ * Unit roundoff of the floating point type
+ * @tparam T floating point type
+ * @return u from FloatTraits
+ */
+template<typename T>
+constexpr typename FloatTraits<T>::real UnitRoundoff() {
+    return FloatTraits<T>::unit_roundoff;
+}
+
+/**
+ * Constant of the standard rounding error analysis
+ * @tparam T floating point type
+ * @param n number of operations
+ * @return gamma_n = n * u / (1 - n * u)
+ */
+template<typename T>
+constexpr typename FloatTraits<T>::real Gamma(const indexType &n) {
+    return FloatTraits<T>::Gamma(n);
+}
+
 /**
  * Error-free transformation of the sum of 2 floating point numbers
  * @tparam T floating point type
@@ -75,7 +149,50 @@ ReturnStruct<T> TwoSum(const T &a, const T &b) {
 }
 
 /**
- * Error-free transformation of the product of to floating point numbers with Fused Multiply and add (FMA)
+ * Error-free transformation of the sum of 2 floating point numbers with |a| >= |b| (Dekker)
+ * @tparam T floating point type
+ * @param a floating point number
+ * @param b floating point number, not greater than a in magnitude
+ * @return struct: sum of numbers and error
+ */
+template<typename T>
+ReturnStruct<T> FastTwoSum(const T &a, const T &b) {
+
+    ReturnStruct<T> out;
+
+    out.result = a + b;
+    out.error = b - (out.result - a);
+
+    return out;
+}
+
+/**
+ * Veltkamp splitting of a floating point number into two halves with non-overlapping mantissas
+ * @tparam T floating point type
+ * @param a floating point number
+ * @return struct: high half of a and low half of a, a = result + error exactly
+ */
+template<typename T>
+POLYNOMEVALUATION_NO_CONTRACT constexpr ReturnStruct<T> Split(const T &a) {
+
+    constexpr T factor = static_cast<T>((1ull << ((FloatTraits<T>::digits + 1) / 2)) + 1);
+
+    ReturnStruct<T> out;
+
+    const T c = factor * a;
+    out.result = c - (c - a);
+    out.error = a - out.result;
+
+    return out;
+}
+
+template<typename T>
+POLYNOMEVALUATION_NO_CONTRACT ReturnStruct<T> TwoProduct(const T &a,
+                                                         const T &b);
+
+/**
+ * Error-free transformation of the product of to floating point numbers with Fused Multiply and add (FMA),
+ * types without fast fma in FloatTraits (targets without FMA) use Dekker's product
  * @tparam T floating point type
  * @param a floating point number
  * @param b floating point number
@@ -84,14 +201,56 @@ ReturnStruct<T> TwoSum(const T &a, const T &b) {
 template<typename T>
 ReturnStruct<T> TwoProductFMA(const T &a,
                               const T &b) {
+    if constexpr (!FloatTraits<T>::has_fma) {
+        return TwoProduct(a, b);
+    } else {
+        ReturnStruct<T> out;
+
+        out.result = a * b;
+        out.error = std::fma(a, b, -out.result);
+
+        return out;
+    }
+}
+
+/**
+ * Error-free transformation of the product of two floating point numbers without FMA (Dekker)
+ * with precomputed split of the first factor
+ * @tparam T floating point type
+ * @param a floating point number
+ * @param a_split Veltkamp split of a
+ * @param b floating point number
+ * @return struct: result of a * b and error
+ */
+template<typename T>
+POLYNOMEVALUATION_NO_CONTRACT ReturnStruct<T> TwoProduct(const T &a,
+                                                         const ReturnStruct<T> &a_split,
+                                                         const T &b) {
     ReturnStruct<T> out;
 
+    const ReturnStruct<T> b_split = Split(b);
+
     out.result = a * b;
-    out.error = std::fma(a, b, -out.result);
+    out.error = a_split.error * b_split.error - (((out.result - a_split.result * b_split.result) -
+                                                  a_split.error * b_split.result) - a_split.result * b_split.error);
 
     return out;
 }
 
+/**
+ * Error-free transformation of the product of two floating point numbers without FMA (Dekker),
+ * the factors are split with Veltkamp's algorithm
+ * @tparam T floating point type
+ * @param a floating point number
+ * @param b floating point number
+ * @return struct: result of a * b and error
+ */
+template<typename T>
+POLYNOMEVALUATION_NO_CONTRACT ReturnStruct<T> TwoProduct(const T &a,
+                                                         const T &b) {
+    return TwoProduct(a, Split(a), b);
+}
+
 /**
  * Horner scheme
  * @tparam T floating point type
@@ -140,4 +299,88 @@ T CompensatedHorner(const Polynom<T, N> &polynom, const T &x) {
     return s.result + Horner(polynom_pi + polynom_sigma, x);
 }
 
+/**
+ * Horner scheme for polynom view
+ * @tparam T floating point type
+ * @param polynom view of FP coeffs
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T>
+T Horner(const PolynomView<T> &polynom, const T &x) {
+
+    T sum = polynom[polynom.Degree()];
+
+    for (indexType i = polynom.Degree(); i >= 1; i--) {
+        sum = sum * x + polynom[i - 1];
+    }
+
+    return sum;
+}
+
+/**
+ * Compensated Horner Scheme for polynom view. The errors are accumulated on the fly instead of the pi and sigma
+ * polynoms, which gives the same result without storage depending on the degree
+ * @tparam T floating point type
+ * @param polynom view of FP coeffs
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T>
+T CompensatedHorner(const PolynomView<T> &polynom, const T &x) {
+
+    ReturnStruct<T> p, s;
+    s.result = polynom[polynom.Degree()];
+    T error = 0;
+
+    for (indexType i = polynom.Degree(); i >= 1; i--) {
+
+        p = TwoProductFMA(s.result, x);
+        s = TwoSum(p.result, polynom[i - 1]);
+
+        error = error * x + (p.error + s.error);
+    }
+
+    return s.result + error;
+}
+
+/**
+ * Compensated Horner Scheme with a posteriori error bound (Langlois, Louvet):
+ * |result - p(x)| <= (u * |result| + gamma_{4N+2} * Horner(|pi| + |sigma|, |x|) + 2 * u ^ 2 * |result|) / (1 - 2 * (N + 1) * u)
+ * where the last division covers the rounding of the bound itself. Underflow is not taken into account
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @return struct: polynom value in point x and its error bound
+ */
+template<typename T, indexType N>
+BoundStruct<T> CompensatedHornerWithBound(const Polynom<T, N> &polynom, const T &x) {
+
+    Polynom<T, N - 1> polynom_error, polynom_abs_error;
+
+    ReturnStruct<T> p, s;
+    s.result = polynom[N];
+
+    for (indexType i = N; i >= 1; i--) {
+
+        p = TwoProductFMA(s.result, x);
+        s = TwoSum(p.result, polynom[i - 1]);
+
+        polynom_error[i - 1] = p.error + s.error;
+        polynom_abs_error[i - 1] = std::abs(p.error) + std::abs(s.error);
+    }
+
+    const T u = UnitRoundoff<T>();
+
+    BoundStruct<T> out;
+    out.result = s.result + Horner(polynom_error, x);
+
+    const T abs_result = std::abs(out.result);
+    out.bound = (u * abs_result + (Gamma<T>(4 * N + 2) * Horner(polynom_abs_error, std::abs(x)) +
+                                   2 * u * u * abs_result)) / (1 - 2 * (N + 1) * u);
+
+    return out;
+}
+
 #endif //POLYNOMEVALUATION_POLYNOM_H
@@ -0,0 +1,265 @@
+#ifndef POLYNOMEVALUATION_POLYNOMMULTIPLICATION_H
+#define POLYNOMEVALUATION_POLYNOMMULTIPLICATION_H
+
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <complex>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Degree of the product from which Karatsuba replaces the schoolbook algorithm
+ */
+constexpr indexType KaratsubaThreshold = 32;
+
+/**
+ * Degree of the product from which FFT replaces Karatsuba (floating point coefficients only)
+ */
+constexpr indexType FFTThreshold = 1024;
+
+namespace Detail {
+
+    /**
+     * Schoolbook product, accumulated into out: out += a * b
+     * @tparam T coefficient type
+     * @param a coeffs of the first factor
+     * @param a_size number of coeffs of the first factor
+     * @param b coeffs of the second factor
+     * @param b_size number of coeffs of the second factor
+     * @param out coeffs of the product, a_size + b_size - 1 elements
+     */
+    template<typename T>
+    void SchoolbookMultiply(const T *a, const indexType a_size, const T *b, const indexType b_size, T *out) {
+
+        for (indexType i = 0; i < a_size; ++i) {
+            for (indexType j = 0; j < b_size; ++j) {
+                out[i + j] += a[i] * b[j];
+            }
+        }
+    }
+
+    /**
+     * Karatsuba product, accumulated into out: out += a * b
+     * @tparam T coefficient type
+     * @param a coeffs of the first factor
+     * @param a_size number of coeffs of the first factor
+     * @param b coeffs of the second factor
+     * @param b_size number of coeffs of the second factor
+     * @param out coeffs of the product, a_size + b_size - 1 elements
+     */
+    template<typename T>
+    void KaratsubaMultiply(const T *a, const indexType a_size, const T *b, const indexType b_size, T *out) {
+
+        if (a_size < KaratsubaThreshold || b_size < KaratsubaThreshold) {
+            SchoolbookMultiply(a, a_size, b, b_size, out);
+            return;
+        }
+
+        const indexType m = (std::max(a_size, b_size) + 1) / 2;
+
+        if (a_size <= m) {
+            KaratsubaMultiply(a, a_size, b, m, out);
+            KaratsubaMultiply(a, a_size, b + m, b_size - m, out + m);
+            return;
+        }
+
+        if (b_size <= m) {
+            KaratsubaMultiply(a, m, b, b_size, out);
+            KaratsubaMultiply(a + m, a_size - m, b, b_size, out + m);
+            return;
+        }
+
+        const indexType a_high_size = a_size - m;
+        const indexType b_high_size = b_size - m;
+
+        std::vector<T> z0(2 * m - 1, T(0));
+        std::vector<T> z2(a_high_size + b_high_size - 1, T(0));
+        std::vector<T> z1(2 * m - 1, T(0));
+        std::vector<T> a_sum(a, a + m);
+        std::vector<T> b_sum(b, b + m);
+
+        for (indexType i = 0; i < a_high_size; ++i) {
+            a_sum[i] += a[m + i];
+        }
+        for (indexType i = 0; i < b_high_size; ++i) {
+            b_sum[i] += b[m + i];
+        }
+
+        KaratsubaMultiply(a, m, b, m, z0.data());
+        KaratsubaMultiply(a + m, a_high_size, b + m, b_high_size, z2.data());
+        KaratsubaMultiply(a_sum.data(), m, b_sum.data(), m, z1.data());
+
+        for (indexType i = 0; i < z0.size(); ++i) {
+            z1[i] -= z0[i];
+            out[i] += z0[i];
+        }
+        for (indexType i = 0; i < z2.size(); ++i) {
+            z1[i] -= z2[i];
+            out[2 * m + i] += z2[i];
+        }
+        for (indexType i = 0; i < z1.size(); ++i) {
+            out[m + i] += z1[i];
+        }
+    }
+
+    /**
+     * In-place iterative radix-2 FFT
+     * @tparam T floating point type
+     * @param data complex values, size is a power of two
+     * @param inverse true for the inverse transform (without 1/n scaling)
+     */
+    template<typename T>
+    void FFT(std::vector<std::complex<T>> &data, const bool inverse) {
+
+        const indexType n = data.size();
+
+        for (indexType i = 1, j = 0; i < n; ++i) {
+            indexType bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(data[i], data[j]);
+            }
+        }
+
+        for (indexType length = 2; length <= n; length <<= 1) {
+            const T angle = (inverse ? 2 : -2) * std::numbers::pi_v<T> / static_cast<T>(length);
+
+            for (indexType k = 0; k < length / 2; ++k) {
+                const std::complex<T> w(std::cos(angle * k), std::sin(angle * k));
+
+                for (indexType i = 0; i < n; i += length) {
+                    const std::complex<T> u = data[i + k];
+                    const std::complex<T> v = data[i + k + length / 2] * w;
+                    data[i + k] = u + v;
+                    data[i + k + length / 2] = u - v;
+                }
+            }
+        }
+    }
+
+    /**
+     * FFT product, accumulated into out: out += a * b.
+     * Rounding error is normwise: it is bounded relative to max|a| * max|b|, not to each coefficient
+     * @tparam T floating point type
+     * @param a coeffs of the first factor
+     * @param a_size number of coeffs of the first factor
+     * @param b coeffs of the second factor
+     * @param b_size number of coeffs of the second factor
+     * @param out coeffs of the product, a_size + b_size - 1 elements
+     */
+    template<typename T>
+    void FFTMultiply(const T *a, const indexType a_size, const T *b, const indexType b_size, T *out) {
+
+        const indexType out_size = a_size + b_size - 1;
+        indexType n = 1;
+        while (n < out_size) {
+            n <<= 1;
+        }
+
+        std::vector<std::complex<T>> fa(n), fb(n);
+        for (indexType i = 0; i < a_size; ++i) {
+            fa[i] = a[i];
+        }
+        for (indexType i = 0; i < b_size; ++i) {
+            fb[i] = b[i];
+        }
+
+        FFT(fa, false);
+        FFT(fb, false);
+
+        for (indexType i = 0; i < n; ++i) {
+            fa[i] *= fb[i];
+        }
+
+        FFT(fa, true);
+
+        for (indexType i = 0; i < out_size; ++i) {
+            out[i] += fa[i].real() / static_cast<T>(n);
+        }
+    }
+}
+
+/**
+ * Polynom multiplication: schoolbook for low degrees, Karatsuba for moderate and FFT for high degrees
+ * @tparam T coefficient type
+ * @tparam N degree of the first polynom
+ * @tparam M degree of the second polynom
+ * @param lhs first polynom
+ * @param rhs second polynom
+ * @return product polynom of degree N + M
+ */
+template<typename T, indexType N, indexType M>
+Polynom<T, N + M> Multiply(const Polynom<T, N> &lhs, const Polynom<T, M> &rhs) {
+
+    Polynom<T, N + M> result;
+    for (indexType i = 0; i < N + M + 1; ++i) {
+        result[i] = T(0);
+    }
+
+    if constexpr (N + M < KaratsubaThreshold) {
+        Detail::SchoolbookMultiply(&lhs[0], N + 1, &rhs[0], M + 1, &result[0]);
+    } else if constexpr (N + M < FFTThreshold || !std::is_floating_point_v<T>) {
+        Detail::KaratsubaMultiply(&lhs[0], N + 1, &rhs[0], M + 1, &result[0]);
+    } else {
+        Detail::FFTMultiply(&lhs[0], N + 1, &rhs[0], M + 1, &result[0]);
+    }
+
+    return result;
+}
+
+/**
+ * Compensated polynom multiplication. Every coefficient is a dot product accumulated with TwoProductFMA and TwoSum,
+ * so result + error represents the product as if computed in twice the working precision.
+ * The pair can be evaluated as CompensatedHorner(result, x) + Horner(error, x)
+ * @tparam T floating point type
+ * @tparam N degree of the first polynom
+ * @tparam M degree of the second polynom
+ * @param lhs first polynom
+ * @param rhs second polynom
+ * @return struct: rounded product polynom and polynom of its rounding errors
+ */
+template<typename T, indexType N, indexType M>
+ReturnStruct<Polynom<T, N + M>> MultiplyCompensated(const Polynom<T, N> &lhs, const Polynom<T, M> &rhs) {
+
+    ReturnStruct<Polynom<T, N + M>> out;
+    for (indexType i = 0; i < N + M + 1; ++i) {
+        out.result[i] = T(0);
+        out.error[i] = T(0);
+    }
+
+    ReturnStruct<T> p, s;
+
+    for (indexType i = 0; i < N + 1; ++i) {
+        for (indexType j = 0; j < M + 1; ++j) {
+
+            p = TwoProductFMA(lhs[i], rhs[j]);
+            s = TwoSum(out.result[i + j], p.result);
+
+            out.result[i + j] = s.result;
+            out.error[i + j] += p.error + s.error;
+        }
+    }
+
+    return out;
+}
+
+/**
+ * Polynom multiplication operator, see Multiply
+ * @tparam T coefficient type
+ * @tparam N degree of the first polynom
+ * @tparam M degree of the second polynom
+ * @param lhs first polynom
+ * @param rhs second polynom
+ * @return product polynom of degree N + M
+ */
+template<typename T, indexType N, indexType M>
+Polynom<T, N + M> operator*(const Polynom<T, N> &lhs, const Polynom<T, M> &rhs) {
+    return Multiply(lhs, rhs);
+}
+
+#endif //POLYNOMEVALUATION_POLYNOMMULTIPLICATION_H
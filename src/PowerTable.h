@@ -0,0 +1,202 @@
+#ifndef POLYNOMEVALUATION_POWERTABLE_H
+#define POLYNOMEVALUATION_POWERTABLE_H
+
+#include "DoubleDouble.h"
+#include "PolynomEvaluation.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Powers x ^ 0, ..., x ^ N of a fixed grid of points in double-double form.
+ * Powers of one degree are contiguous over the grid, so evaluation of any polynom of degree up to N
+ * is a compensated dot product vectorized over the points, without Horner's dependency chain
+ * @tparam T floating point type
+ * @tparam N maximal polynom degree
+ */
+template<typename T, indexType N>
+class PowerTable {
+
+private:
+    indexType size_ = 0;
+    std::vector<T> hi_;
+    std::vector<T> lo_;
+    std::vector<T> abs_;
+
+    template<bool Dekker>
+    [[gnu::always_inline]] inline void EvaluateKernel(const T *coeffs, const T *split_high, const T *split_low,
+                                                      const indexType degree, T *out) const {
+
+        std::vector<T> error(size_, T(0));
+
+        for (indexType j = 0; j < size_; ++j) {
+            out[j] = coeffs[0];
+        }
+
+        for (indexType k = 1; k < degree + 1; ++k) {
+            const T a = coeffs[k];
+            const T *hi = hi_.data() + k * size_;
+            const T *lo = lo_.data() + k * size_;
+
+            ReturnStruct<T> a_split{};
+            if constexpr (Dekker) {
+                a_split = {split_high[k], split_low[k]};
+            }
+
+            for (indexType j = 0; j < size_; ++j) {
+                ReturnStruct<T> p;
+                if constexpr (Dekker) {
+                    p = TwoProduct(a, a_split, hi[j]);
+                } else {
+                    p = TwoProductFMA(a, hi[j]);
+                }
+                const ReturnStruct<T> s = TwoSum(out[j], p.result);
+
+                out[j] = s.result;
+                error[j] += (p.error + s.error) + a * lo[j];
+            }
+        }
+
+        for (indexType j = 0; j < size_; ++j) {
+            out[j] += error[j];
+        }
+    }
+
+    void EvaluateFMA(const T *coeffs, const indexType degree, T *out) const {
+        EvaluateKernel<false>(coeffs, nullptr, nullptr, degree, out);
+    }
+
+    // Dekker's products are exact only without contraction
+    POLYNOMEVALUATION_NO_CONTRACT
+    void EvaluateDekker(const T *coeffs, const T *split_high, const T *split_low, const indexType degree,
+                        T *out) const {
+        EvaluateKernel<true>(coeffs, split_high, split_low, degree, out);
+    }
+
+public:
+
+    /**
+     * Precomputes the powers of the grid
+     * @param x grid points
+     * @param size number of points
+     */
+    PowerTable(const T *x, const indexType size) : size_(size), hi_((N + 1) * size), lo_((N + 1) * size),
+                                                   abs_((N + 1) * size) {
+
+        for (indexType j = 0; j < size_; ++j) {
+            DoubleDouble<T> power{1, 0};
+            hi_[j] = 1;
+            lo_[j] = 0;
+            abs_[j] = 1;
+
+            for (indexType k = 1; k < N + 1; ++k) {
+                power = power * x[j];
+                hi_[k * size_ + j] = power.hi;
+                lo_[k * size_ + j] = power.lo;
+                abs_[k * size_ + j] = std::abs(power.hi);
+            }
+        }
+    }
+
+    indexType Size() const {
+        return size_;
+    }
+
+    /**
+     * Power of the grid point
+     * @param k power
+     * @param j point index
+     * @return x_j ^ k in double-double form
+     */
+    DoubleDouble<T> Power(const indexType &k, const indexType &j) const {
+        return {hi_[k * size_ + j], lo_[k * size_ + j]};
+    }
+
+    /**
+     * Compensated evaluation in all grid points: sum of a_k * x ^ k accumulated with TwoProductFMA and TwoSum,
+     * the low parts of the powers enter the correction term
+     * @tparam M polynom degree, not greater than N
+     * @param polynom polynom with FP coeffs
+     * @param out polynom values in the grid points
+     */
+    template<indexType M>
+    void Evaluate(const Polynom<T, M> &polynom, T *out) const {
+
+        static_assert(M <= N, "polynom degree exceeds the power table");
+
+        EvaluateFMA(&polynom[0], M, out);
+    }
+
+    /**
+     * Compensated evaluation of the polynom view in all grid points, see Evaluate
+     * @param polynom view of FP coeffs, degree not greater than N
+     * @param out polynom values in the grid points
+     */
+    void Evaluate(const PolynomView<T> &polynom, T *out) const {
+
+        if (polynom.Degree() > N) {
+            throw std::invalid_argument("polynom degree exceeds the power table");
+        }
+
+        EvaluateFMA(polynom.Data(), polynom.Degree(), out);
+    }
+
+    /**
+     * Compensated evaluation with Dekker's products for targets without FMA: every coeff multiplies all grid points,
+     * so its precomputed Veltkamp split (e.g. stored in a coefficient set) is reused over the grid. The kernel is
+     * compiled without contraction, results are equal to Evaluate compiled the same way and for other builds
+     * stay within the bound of EvaluateWithBound
+     * @param polynom view of FP coeffs, degree not greater than N
+     * @param split_high high halves of the coeffs
+     * @param split_low low halves of the coeffs
+     * @param out polynom values in the grid points
+     */
+    void Evaluate(const PolynomView<T> &polynom, const PolynomView<T> &split_high, const PolynomView<T> &split_low,
+                  T *out) const {
+
+        if (polynom.Degree() > N) {
+            throw std::invalid_argument("polynom degree exceeds the power table");
+        }
+        if (split_high.Degree() != polynom.Degree() || split_low.Degree() != polynom.Degree()) {
+            throw std::invalid_argument("splits do not match the polynom");
+        }
+
+        EvaluateDekker(polynom.Data(), split_high.Data(), split_low.Data(), polynom.Degree(), out);
+    }
+
+    /**
+     * Compensated evaluation with a priori error bounds
+     * |result - p(x)| <= u * |result| + 2 * gamma_{2M+2} ^ 2 * sum of |a_k| * |x| ^ k
+     * @tparam M polynom degree, not greater than N
+     * @param polynom polynom with FP coeffs
+     * @param out polynom values in the grid points
+     * @param bound error bounds of the values
+     */
+    template<indexType M>
+    void EvaluateWithBound(const Polynom<T, M> &polynom, T *out, T *bound) const {
+
+        Evaluate(polynom, out);
+
+        const T gamma = Gamma<T>(2 * M + 2);
+
+        for (indexType j = 0; j < size_; ++j) {
+            bound[j] = std::abs(polynom[0]);
+        }
+
+        for (indexType k = 1; k < M + 1; ++k) {
+            const T a = std::abs(polynom[k]);
+            const T *power = abs_.data() + k * size_;
+
+            for (indexType j = 0; j < size_; ++j) {
+                bound[j] += a * power[j];
+            }
+        }
+
+        for (indexType j = 0; j < size_; ++j) {
+            bound[j] = UnitRoundoff<T>() * std::abs(out[j]) + 2 * gamma * gamma * bound[j] * (1 + gamma);
+        }
+    }
+};
+
+#endif //POLYNOMEVALUATION_POWERTABLE_H
@@ -0,0 +1,410 @@
+#ifndef POLYNOMEVALUATION_REMEZAPPROXIMATION_H
+#define POLYNOMEVALUATION_REMEZAPPROXIMATION_H
+
+#include "ParallelEvaluation.h"
+#include "PolynomEvaluation.h"
+#include "PolynomMultiplication.h"
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * Error curve samples per reference point in the extrema search of the Remez algorithm
+ */
+constexpr indexType RemezSamplesPerNode = 64;
+
+template<typename T, indexType N>
+struct RemezStruct {
+    Polynom<T, N> polynom;
+    T max_error;
+    indexType iterations;
+    bool converged;
+};
+
+/**
+ * Lowest-degree minimax approximation meeting a target error, zero-padded to the maximal degree
+ */
+template<typename T, indexType N>
+struct RemezTargetStruct {
+    RemezStruct<T, N> approximation;
+    indexType degree;
+    bool found;
+};
+
+namespace Detail {
+
+    /**
+     * Gaussian elimination with partial pivoting, the system is overwritten
+     * @param matrix row-major size x size matrix
+     * @param rhs right-hand side, the solution on return
+     */
+    template<typename T>
+    void SolveLinear(std::vector<T> &matrix, std::vector<T> &rhs, const indexType size) {
+
+        for (indexType k = 0; k < size; ++k) {
+
+            indexType pivot = k;
+            for (indexType i = k + 1; i < size; ++i) {
+                if (std::abs(matrix[i * size + k]) > std::abs(matrix[pivot * size + k])) {
+                    pivot = i;
+                }
+            }
+
+            if (matrix[pivot * size + k] == 0) {
+                throw std::runtime_error("singular Remez system");
+            }
+
+            if (pivot != k) {
+                for (indexType j = 0; j < size; ++j) {
+                    std::swap(matrix[k * size + j], matrix[pivot * size + j]);
+                }
+                std::swap(rhs[k], rhs[pivot]);
+            }
+
+            for (indexType i = k + 1; i < size; ++i) {
+                const T factor = matrix[i * size + k] / matrix[k * size + k];
+                for (indexType j = k; j < size; ++j) {
+                    matrix[i * size + j] -= factor * matrix[k * size + j];
+                }
+                rhs[i] -= factor * rhs[k];
+            }
+        }
+
+        for (indexType k = size; k >= 1; k--) {
+            T sum = rhs[k - 1];
+            for (indexType j = k; j < size; ++j) {
+                sum -= matrix[(k - 1) * size + j] * rhs[j];
+            }
+            rhs[k - 1] = sum / matrix[(k - 1) * size + k - 1];
+        }
+    }
+
+    /**
+     * Adds q_K * (alpha * x + beta) ^ K, ..., q_N * (alpha * x + beta) ^ N to out, the powers come from Multiply
+     */
+    template<indexType K, typename T, indexType N>
+    void AccumulateAffine(const Polynom<T, N> &reduced, const Polynom<T, K> &power, const Polynom<T, 1> &line,
+                          Polynom<T, N> &out) {
+
+        for (indexType i = 0; i < K + 1; ++i) {
+            out[i] += reduced[K] * power[i];
+        }
+
+        if constexpr (K < N) {
+            AccumulateAffine<K + 1>(reduced, Multiply(power, line), line, out);
+        }
+    }
+
+    /**
+     * Maximum of |error| on [lo, hi] by golden section, the error curve is unimodal between grid neighbours
+     */
+    template<typename T, typename Error>
+    T RefineExtremum(const Error &error, T lo, T hi) {
+
+        const T ratio = 1 / std::numbers::phi_v<T>;
+
+        T first = hi - ratio * (hi - lo), second = lo + ratio * (hi - lo);
+        T first_value = std::abs(error(first)), second_value = std::abs(error(second));
+
+        for (indexType i = 0; i < 48 && first < second; ++i) {
+            if (first_value >= second_value) {
+                hi = second;
+                second = first;
+                second_value = first_value;
+                first = hi - ratio * (hi - lo);
+                first_value = std::abs(error(first));
+            } else {
+                lo = first;
+                first = second;
+                first_value = second_value;
+                second = lo + ratio * (hi - lo);
+                second_value = std::abs(error(second));
+            }
+        }
+
+        return first_value >= second_value ? first : second;
+    }
+
+    /**
+     * Largest |error| of every run of constant sign of the sampled error curve
+     * @return grid indices of the extrema
+     */
+    template<typename T>
+    std::vector<indexType> SignRunExtrema(const std::vector<T> &errors) {
+
+        std::vector<indexType> extrema;
+        int sign = 0;
+
+        for (indexType j = 0; j < errors.size(); ++j) {
+            const int current = errors[j] > 0 ? 1 : (errors[j] < 0 ? -1 : 0);
+
+            if (current == 0) {
+                continue;
+            }
+            if (current != sign) {
+                extrema.push_back(j);
+                sign = current;
+            } else if (std::abs(errors[j]) > std::abs(errors[extrema.back()])) {
+                extrema.back() = j;
+            }
+        }
+
+        return extrema;
+    }
+
+    /**
+     * Alternating extrema of the sampled error curve: the extrema of the sign runs,
+     * runs at the ends are dropped while there are more than count of them
+     * @return grid indices of the extrema, empty if the curve alternates less than count times
+     */
+    template<typename T>
+    std::vector<indexType> AlternatingExtrema(const std::vector<T> &errors, const indexType count) {
+
+        const std::vector<indexType> extrema = SignRunExtrema(errors);
+
+        if (extrema.size() < count) {
+            return {};
+        }
+
+        indexType begin = 0, end = extrema.size();
+        while (end - begin > count) {
+            if (std::abs(errors[extrema[begin]]) < std::abs(errors[extrema[end - 1]])) {
+                ++begin;
+            } else {
+                --end;
+            }
+        }
+
+        return {extrema.begin() + begin, extrema.begin() + end};
+    }
+
+    /**
+     * Refines the grid extrema in parallel. The search interval of every extremum is clamped to the midpoints
+     * between it and its neighbours, so the refined points keep the order of the grid
+     * @return refined points, strictly increasing
+     */
+    template<typename T, typename Error>
+    std::vector<T> RefineExtrema(const Error &error, const std::vector<T> &grid,
+                                 const std::vector<indexType> &extrema) {
+
+        std::vector<indexType> order(extrema.size());
+        std::iota(order.begin(), order.end(), indexType(0));
+
+        std::vector<T> refined(extrema.size());
+        std::transform(std::execution::par, order.begin(), order.end(), refined.begin(),
+                       [&error, &grid, &extrema](const indexType &i) {
+                           const indexType j = extrema[i];
+
+                           T lo = grid[j > 0 ? j - 1 : j], hi = grid[j + 1 < grid.size() ? j + 1 : j];
+                           if (i > 0) {
+                               lo = std::max(lo, (grid[extrema[i - 1]] + grid[j]) / 2);
+                           }
+                           if (i + 1 < extrema.size()) {
+                               hi = std::min(hi, (grid[j] + grid[extrema[i + 1]]) / 2);
+                           }
+
+                           return RefineExtremum(error, lo, hi);
+                       });
+
+        // neighbours refined onto their common midpoint: the grid point is strictly inside the clamped interval
+        for (indexType i = 1; i < refined.size(); ++i) {
+            if (!(refined[i - 1] < refined[i])) {
+                refined[i] = grid[extrema[i]];
+            }
+        }
+
+        return refined;
+    }
+}
+
+/**
+ * Minimax polynom approximation by the Remez exchange algorithm. The reference starts at the Chebyshev extrema
+ * of [a, b] mapped to t in [-1, 1], every iteration solves for the levelled reference error, samples the error
+ * curve on a grid in parallel (CompensatedHorner through EvaluateRange) and moves the reference to the refined
+ * alternating extrema. The polynom in t is converted to x by Multiply, max_error is measured after the conversion
+ * on the grid and the refined extrema of the final error, so the coeffs are ready for Horner and the batch kernels.
+ * RemezToTarget chooses the degree for a target error, intervals far from zero compared to their width favour
+ * low degrees
+ * @tparam N polynom degree
+ * @tparam T floating point type
+ * @tparam Function callable T -> T, called concurrently
+ * @param function approximated function, continuous on [a, b]
+ * @param a lower end of the interval
+ * @param b upper end of the interval
+ * @param tolerance relative spread of |error| over the reference at which the iteration stops,
+ * spreads below the rounding level 8 * u * max |polynom| also stop it
+ * @param max_iterations maximum number of exchanges
+ * @return struct: polynom in x, maximum of |function - polynom| on the grid and its refined extrema,
+ * number of iterations and whether the reference error was levelled (or the error curve is rounding noise)
+ */
+template<indexType N, typename T, typename Function>
+RemezStruct<T, N> Remez(const Function &function, const T &a, const T &b, const T &tolerance = 1e-6,
+                        const indexType &max_iterations = 32) {
+
+    if (!(a < b)) {
+        throw std::invalid_argument("empty interval");
+    }
+
+    constexpr indexType count = N + 2;
+
+    const T center = (a + b) / 2, radius = (b - a) / 2;
+    const auto to_x = [center, radius](const T &t) { return center + radius * t; };
+
+    std::vector<T> reference(count);
+    for (indexType i = 0; i < count; ++i) {
+        reference[i] = -std::cos(std::numbers::pi_v<T> * static_cast<T>(i) / static_cast<T>(count - 1));
+    }
+
+    std::vector<T> grid(RemezSamplesPerNode * count + 1);
+    for (indexType j = 0; j < grid.size(); ++j) {
+        grid[j] = -std::cos(std::numbers::pi_v<T> * static_cast<T>(j) / static_cast<T>(grid.size() - 1));
+    }
+
+    std::vector<T> values(grid.size()), errors(grid.size());
+
+    RemezStruct<T, N> out;
+    out.iterations = 0;
+    out.converged = false;
+
+    Polynom<T, N> reduced;
+
+    for (indexType iteration = 1; iteration <= max_iterations; ++iteration) {
+
+        std::vector<T> matrix(count * count), rhs(count);
+        for (indexType i = 0; i < count; ++i) {
+            T power = 1;
+            for (indexType j = 0; j < N + 1; ++j) {
+                matrix[i * count + j] = power;
+                power *= reference[i];
+            }
+            matrix[i * count + N + 1] = i % 2 == 0 ? 1 : -1;
+            rhs[i] = function(to_x(reference[i]));
+        }
+
+        Detail::SolveLinear(matrix, rhs, count);
+        for (indexType j = 0; j < N + 1; ++j) {
+            reduced[j] = rhs[j];
+        }
+
+        const auto error = [&function, &reduced, &to_x](const T &t) {
+            return function(to_x(t)) - CompensatedHorner(reduced, t);
+        };
+
+        EvaluateRange(std::execution::par, reduced, grid.begin(), grid.end(), values.begin());
+        std::transform(std::execution::par, grid.begin(), grid.end(), values.begin(), errors.begin(),
+                       [&function, &to_x](const T &t, const T &value) { return function(to_x(t)) - value; });
+
+        T noise = 0, largest = 0;
+        for (indexType j = 0; j < grid.size(); ++j) {
+            noise = std::max(noise, std::abs(values[j]));
+            largest = std::max(largest, std::abs(errors[j]));
+        }
+        noise *= 8 * UnitRoundoff<T>();
+
+        out.iterations = iteration;
+
+        const std::vector<indexType> extrema = Detail::AlternatingExtrema(errors, count);
+        if (extrema.empty()) {
+            out.converged = largest <= noise;
+            break;
+        }
+
+        reference = Detail::RefineExtrema(error, grid, extrema);
+
+        T lowest = std::abs(error(reference[0])), highest = lowest;
+        for (indexType i = 1; i < count; ++i) {
+            const T level = std::abs(error(reference[i]));
+            lowest = std::min(lowest, level);
+            highest = std::max(highest, level);
+        }
+
+        if (highest - lowest <= tolerance * highest + noise) {
+            out.converged = true;
+            break;
+        }
+    }
+
+    for (indexType i = 0; i < N + 1; ++i) {
+        out.polynom[i] = T(0);
+    }
+    Detail::AccumulateAffine<0>(reduced, Polynom<T, 0>({T(1)}), Polynom<T, 1>({-center / radius, 1 / radius}),
+                                out.polynom);
+
+    const auto final_error = [&function, &out, &to_x](const T &t) {
+        return function(to_x(t)) - CompensatedHorner(out.polynom, to_x(t));
+    };
+
+    std::transform(std::execution::par, grid.begin(), grid.end(), errors.begin(), final_error);
+    const std::vector<T> peaks = Detail::RefineExtrema(final_error, grid, Detail::SignRunExtrema(errors));
+
+    out.max_error = 0;
+    for (const T &e: errors) {
+        out.max_error = std::max(out.max_error, std::abs(e));
+    }
+    for (const T &t: peaks) {
+        out.max_error = std::max(out.max_error, std::abs(final_error(t)));
+    }
+
+    return out;
+}
+
+namespace Detail {
+
+    template<indexType N, indexType MaxN, typename T, typename Function>
+    RemezTargetStruct<T, MaxN> RemezToTarget(const Function &function, const T &a, const T &b, const T &target,
+                                             const T &tolerance, const indexType &max_iterations) {
+
+        const RemezStruct<T, N> approximation = Remez<N>(function, a, b, tolerance, max_iterations);
+
+        if constexpr (N < MaxN) {
+            if (!(approximation.max_error <= target)) {
+                return RemezToTarget<N + 1, MaxN>(function, a, b, target, tolerance, max_iterations);
+            }
+        }
+
+        RemezTargetStruct<T, MaxN> out;
+        for (indexType i = 0; i < MaxN + 1; ++i) {
+            out.approximation.polynom[i] = i < N + 1 ? approximation.polynom[i] : T(0);
+        }
+        out.approximation.max_error = approximation.max_error;
+        out.approximation.iterations = approximation.iterations;
+        out.approximation.converged = approximation.converged;
+        out.degree = N;
+        out.found = approximation.max_error <= target;
+
+        return out;
+    }
+}
+
+/**
+ * Minimax approximation at a target error: Remez<N> for N = 1, ..., MaxN, the first result with
+ * max_error <= target is returned. Its coeffs are zero-padded to degree MaxN, Horner of the padded polynom
+ * gives the values of the degree N one
+ * @tparam MaxN maximal polynom degree
+ * @tparam T floating point type
+ * @tparam Function callable T -> T, called concurrently
+ * @param function approximated function, continuous on [a, b]
+ * @param a lower end of the interval
+ * @param b upper end of the interval
+ * @param target maximal admissible |function - polynom|
+ * @param tolerance levelling tolerance of Remez
+ * @param max_iterations maximum number of exchanges of every Remez run
+ * @return struct: approximation of the chosen degree and the degree, not found if even degree MaxN misses
+ * the target, the approximation is then the one of degree MaxN
+ */
+template<indexType MaxN, typename T, typename Function>
+RemezTargetStruct<T, MaxN> RemezToTarget(const Function &function, const T &a, const T &b, const T &target,
+                                         const T &tolerance = 1e-6, const indexType &max_iterations = 32) {
+
+    static_assert(MaxN >= 1, "maximal degree must be at least 1");
+
+    return Detail::RemezToTarget<1, MaxN>(function, a, b, target, tolerance, max_iterations);
+}
+
+#endif //POLYNOMEVALUATION_REMEZAPPROXIMATION_H
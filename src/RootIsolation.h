@@ -0,0 +1,329 @@
+#ifndef POLYNOMEVALUATION_ROOTISOLATION_H
+#define POLYNOMEVALUATION_ROOTISOLATION_H
+
+#include "ExpansionArithmetic.h"
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Interval of real roots: the open interval (lo, hi) or the exact root lo == hi
+ * @tparam T floating point type
+ */
+template<typename T>
+struct RootInterval {
+    T lo;
+    T hi;
+    // number of roots counted with multiplicity, an upper bound of the same parity for clusters
+    indexType count;
+    // true if the count is exact: a single root in (lo, hi) or an exact root lo == hi
+    bool isolated;
+};
+
+/**
+ * Result of the root isolation with the statistics of the exact fallbacks
+ * @tparam T floating point type
+ */
+template<typename T>
+struct RootIsolationStruct {
+    std::vector<RootInterval<T>> intervals;
+    // subdivision nodes visited
+    indexType nodes = 0;
+    // nodes whose Descartes coefficients were recomputed in expansion arithmetic
+    indexType exact_nodes = 0;
+    // point signs decided in expansion arithmetic
+    indexType exact_signs = 0;
+};
+
+namespace Detail {
+
+    /**
+     * Taylor shift p(y) -> p(y + s) of FP coeffs with running absolute error bounds of the coeffs
+     */
+    template<typename T, indexType N>
+    void TaylorShiftWithBound(std::array<T, N + 1> &coeffs, std::array<T, N + 1> &bound, const T &s) {
+
+        const T u = UnitRoundoff<T>();
+
+        for (indexType i = 0; i < N; ++i) {
+            for (indexType j = N; j > i; j--) {
+                const T product = s * coeffs[j];
+                const T sum = coeffs[j - 1] + product;
+
+                bound[j - 1] = (bound[j - 1] + std::abs(s) * bound[j] + u * (std::abs(product) + std::abs(sum))) *
+                               (1 + 4 * u);
+                coeffs[j - 1] = sum;
+            }
+        }
+    }
+
+    /**
+     * Exact Taylor shift p(y) -> p(y + s) in expansion arithmetic
+     */
+    template<typename T>
+    void ExactTaylorShift(std::vector<Expansion<T>> &coeffs, const T &s) {
+
+        const indexType degree = coeffs.size() - 1;
+        Expansion<T> scaled;
+
+        for (indexType i = 0; i < degree; ++i) {
+            for (indexType j = degree; j > i; j--) {
+                ScaleExpansion(coeffs[j], s, scaled);
+                coeffs[j - 1] = ExpansionSum(coeffs[j - 1], scaled);
+                CompressExpansion(coeffs[j - 1]);
+            }
+        }
+    }
+
+    /**
+     * Exact coeffs of p(l + w * y)
+     */
+    template<typename T, indexType N>
+    std::vector<Expansion<T>> ExactIntervalPolynom(const Polynom<T, N> &polynom, const T &l, const T &w) {
+
+        std::vector<Expansion<T>> coeffs(N + 1);
+        for (indexType i = 0; i < N + 1; ++i) {
+            coeffs[i] = {polynom[i]};
+        }
+
+        ExactTaylorShift(coeffs, l);
+
+        Expansion<T> scaled;
+        for (indexType i = 1; i < N + 1; ++i) {
+            for (indexType k = 0; k < i; ++k) {
+                ScaleExpansion(coeffs[i], w, scaled);
+                coeffs[i].swap(scaled);
+            }
+        }
+
+        return coeffs;
+    }
+
+    /**
+     * Sign of the number known up to the absolute error bound
+     * @return true if the sign is certain
+     */
+    template<typename T>
+    bool CertainSign(const T &value, const T &bound, int &sign) {
+        if (std::abs(value) > bound) {
+            sign = value > 0 ? 1 : -1;
+            return true;
+        }
+        if (value == 0 && bound == 0) {
+            sign = 0;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Sign of p(x) from CompensatedHornerWithBound, expansion arithmetic only if the bound does not decide it
+     */
+    template<typename T, indexType N>
+    int PolynomSign(const Polynom<T, N> &polynom, const T &x, RootIsolationStruct<T> &result) {
+
+        const BoundStruct<T> value = CompensatedHornerWithBound(polynom, x);
+
+        int sign;
+        if (CertainSign(value.result, value.bound, sign)) {
+            return sign;
+        }
+
+        ++result.exact_signs;
+        return ExpansionSign(ExactHorner(polynom, x));
+    }
+
+    /**
+     * Multiplicity of the exact root x: number of vanishing Taylor coeffs in x
+     */
+    template<typename T, indexType N>
+    indexType RootMultiplicity(const Polynom<T, N> &polynom, const T &x) {
+
+        const std::vector<Expansion<T>> coeffs = ExactIntervalPolynom(polynom, x, T(1));
+
+        indexType multiplicity = 0;
+        while (multiplicity < N && ExpansionSign(coeffs[multiplicity]) == 0) {
+            ++multiplicity;
+        }
+
+        return multiplicity;
+    }
+
+    /**
+     * Subdivision node: interval [l, l + w] and FP coeffs of p(l + w * y) with their error bounds
+     */
+    template<typename T, indexType N>
+    struct RootIsolationNode {
+        T l;
+        T w;
+        std::array<T, N + 1> coeffs;
+        std::array<T, N + 1> bound;
+        int sign_l;
+        int sign_r;
+    };
+
+    /**
+     * Descartes' rule of signs for the node: variations of the coeffs of (1 + t) ^ N * P(1 / (1 + t)),
+     * the extreme coeffs are the values in the endpoints, their signs are known already.
+     * If some other coeff has an uncertain sign, the node is recomputed exactly and its FP coeffs are refreshed
+     */
+    template<typename T, indexType N>
+    indexType DescartesVariations(const Polynom<T, N> &polynom, RootIsolationNode<T, N> &node,
+                                  RootIsolationStruct<T> &result) {
+
+        std::array<int, N + 1> signs;
+        std::array<T, N + 1> coeffs, bound;
+
+        for (indexType i = 0; i < N + 1; ++i) {
+            coeffs[i] = node.coeffs[N - i];
+            bound[i] = node.bound[N - i];
+        }
+        TaylorShiftWithBound<T, N>(coeffs, bound, T(1));
+
+        bool certain = true;
+        for (indexType i = 1; i < N && certain; ++i) {
+            certain = CertainSign(coeffs[i], bound[i], signs[i]);
+        }
+
+        if (!certain) {
+            ++result.exact_nodes;
+
+            std::vector<Expansion<T>> exact = ExactIntervalPolynom(polynom, node.l, node.w);
+            for (indexType i = 0; i < N + 1; ++i) {
+                node.coeffs[i] = ExpansionRound(exact[i]);
+                node.bound[i] = UnitRoundoff<T>() * std::abs(node.coeffs[i]);
+            }
+
+            std::reverse(exact.begin(), exact.end());
+            ExactTaylorShift(exact, T(1));
+            for (indexType i = 1; i < N; ++i) {
+                signs[i] = ExpansionSign(exact[i]);
+            }
+        }
+
+        signs[0] = node.sign_r;
+        signs[N] = node.sign_l;
+
+        indexType variations = 0;
+        int previous = 0;
+        for (const int &sign: signs) {
+            if (sign != 0) {
+                variations += (previous != 0 && sign != previous);
+                previous = sign;
+            }
+        }
+
+        return variations;
+    }
+}
+
+/**
+ * Real root isolation by Descartes' rule of signs with bisection (Vincent, Collins, Akritas).
+ * The polynom is kept on every subinterval as FP coeffs with error bounds, the signs in the endpoints
+ * are decided by CompensatedHornerWithBound. Expansion arithmetic is used only for the signs that
+ * the bounds leave ambiguous, so clusters of roots cost a few exact nodes instead of exact arithmetic everywhere.
+ * Intervals are dyadic subintervals of the Cauchy bound, bisection stops at the resolution or when the interval
+ * cannot be halved in T: such intervals are reported as clusters. Underflow is not taken into account
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs, nonzero leading coeff
+ * @param resolution width below which intervals are not bisected
+ * @return intervals sorted by lo and statistics
+ */
+template<typename T, indexType N>
+RootIsolationStruct<T> IsolateRealRoots(const Polynom<T, N> &polynom, const T &resolution = T(0)) {
+
+    static_assert(N >= 1, "root isolation requires a polynom of degree at least 1");
+
+    if (polynom[N] == 0) {
+        throw std::invalid_argument("leading coefficient is zero");
+    }
+
+    RootIsolationStruct<T> result;
+
+    T cauchy = 0;
+    for (indexType i = 0; i < N; ++i) {
+        cauchy = std::max(cauchy, std::abs(polynom[i] / polynom[N]));
+    }
+    cauchy = (1 + cauchy) * (1 + 4 * UnitRoundoff<T>());
+    const T radius = std::ldexp(T(1), std::ilogb(cauchy) + 1);
+
+    Detail::RootIsolationNode<T, N> root;
+    root.l = -radius;
+    root.w = 2 * radius;
+    root.sign_l = Detail::PolynomSign(polynom, root.l, result);
+    root.sign_r = Detail::PolynomSign(polynom, root.l + root.w, result);
+    for (indexType i = 0; i < N + 1; ++i) {
+        root.coeffs[i] = polynom[i];
+        root.bound[i] = 0;
+    }
+    Detail::TaylorShiftWithBound<T, N>(root.coeffs, root.bound, root.l);
+    T scale = 1;
+    for (indexType i = 1; i < N + 1; ++i) {
+        scale *= root.w;
+        root.coeffs[i] *= scale;
+        root.bound[i] *= scale;
+    }
+
+    std::vector<Detail::RootIsolationNode<T, N>> stack = {root};
+
+    while (!stack.empty()) {
+
+        Detail::RootIsolationNode<T, N> node = stack.back();
+        stack.pop_back();
+        ++result.nodes;
+
+        const indexType variations = Detail::DescartesVariations(polynom, node, result);
+        if (variations == 0) {
+            continue;
+        }
+
+        const T r = node.l + node.w;
+        if (variations == 1) {
+            result.intervals.push_back({node.l, r, 1, true});
+            continue;
+        }
+
+        const T half = node.w / 2;
+        const T mid = node.l + half;
+        if (node.w <= resolution || mid <= node.l || mid >= r) {
+            result.intervals.push_back({node.l, r, variations, false});
+            continue;
+        }
+
+        const int sign_mid = Detail::PolynomSign(polynom, mid, result);
+        if (sign_mid == 0) {
+            result.intervals.push_back({mid, mid, Detail::RootMultiplicity(polynom, mid), true});
+        }
+
+        Detail::RootIsolationNode<T, N> left = node;
+        left.w = half;
+        left.sign_r = sign_mid;
+        T power = 1;
+        for (indexType i = 1; i < N + 1; ++i) {
+            power /= 2;
+            left.coeffs[i] *= power;
+            left.bound[i] *= power;
+        }
+
+        Detail::RootIsolationNode<T, N> right = left;
+        right.l = mid;
+        right.sign_l = sign_mid;
+        right.sign_r = node.sign_r;
+        Detail::TaylorShiftWithBound<T, N>(right.coeffs, right.bound, T(1));
+
+        stack.push_back(right);
+        stack.push_back(left);
+    }
+
+    std::sort(result.intervals.begin(), result.intervals.end(),
+              [](const RootInterval<T> &a, const RootInterval<T> &b) { return a.lo < b.lo; });
+
+    return result;
+}
+
+#endif //POLYNOMEVALUATION_ROOTISOLATION_H
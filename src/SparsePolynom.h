@@ -0,0 +1,173 @@
+#ifndef POLYNOMEVALUATION_SPARSEPOLYNOM_H
+#define POLYNOMEVALUATION_SPARSEPOLYNOM_H
+
+#include "DoubleDouble.h"
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Polynom stored as terms a_k * x ^ e_k with nonzero coeffs sorted by exponent,
+ * for high degrees with few terms
+ * @tparam T floating point type
+ */
+template<typename T>
+class SparsePolynom {
+
+private:
+    std::vector<indexType> exponents_;
+    std::vector<T> coeffs_;
+
+public:
+
+    SparsePolynom() = default;
+
+    /**
+     * @param exponents exponents of the terms, pairwise different
+     * @param coeffs coeffs of the terms, zero terms are dropped
+     */
+    SparsePolynom(const std::vector<indexType> &exponents, const std::vector<T> &coeffs) {
+
+        if (exponents.size() != coeffs.size()) {
+            throw std::invalid_argument("exponents and coefficients differ in size");
+        }
+
+        std::vector<indexType> order(exponents.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(),
+                  [&exponents](const indexType &a, const indexType &b) { return exponents[a] < exponents[b]; });
+
+        for (indexType i = 0; i < order.size(); ++i) {
+            if (i > 0 && exponents[order[i]] == exponents[order[i - 1]]) {
+                throw std::invalid_argument("repeated exponent");
+            }
+            if (coeffs[order[i]] != 0) {
+                exponents_.push_back(exponents[order[i]]);
+                coeffs_.push_back(coeffs[order[i]]);
+            }
+        }
+    }
+
+    template<indexType N>
+    explicit SparsePolynom(const Polynom<T, N> &polynom) {
+        for (indexType i = 0; i < N + 1; ++i) {
+            if (polynom[i] != 0) {
+                exponents_.push_back(i);
+                coeffs_.push_back(polynom[i]);
+            }
+        }
+    }
+
+    /**
+     * @return number of nonzero terms
+     */
+    indexType Size() const {
+        return coeffs_.size();
+    }
+
+    indexType Degree() const {
+        return exponents_.empty() ? 0 : exponents_.back();
+    }
+
+    indexType Exponent(const indexType &k) const {
+        return exponents_[k];
+    }
+
+    const T &operator[](const indexType &k) const {
+        return coeffs_[k];
+    }
+};
+
+namespace Detail {
+
+    /**
+     * Compensated sum of the terms: the powers x ^ e_k are built in double-double from the squares x ^ (2 ^ j),
+     * each gap between consecutive exponents costs one product per set bit. The products with the coeffs are
+     * accumulated with TwoProductFMA and TwoSum, the low parts of the powers enter the correction term.
+     * The relative error of every power is tracked for the bound: squaring doubles it, a product adds the errors
+     * of the factors, every double-double operation adds 2 * FloatTraits<DoubleDouble<T>>::unit_roundoff
+     */
+    template<bool WithBound, typename T>
+    BoundStruct<T> SparseCompensatedHorner(const SparsePolynom<T> &polynom, const T &x) {
+
+        const T operation = 2 * FloatTraits<DoubleDouble<T>>::unit_roundoff;
+
+        std::vector<DoubleDouble<T>> squares = {{x, 0}};
+        std::vector<T> square_error = {0};
+
+        DoubleDouble<T> power{1, 0};
+        T power_error = 0;
+        indexType exponent = 0;
+
+        T sum = 0, error = 0, abs_sum = 0;
+
+        for (indexType k = 0; k < polynom.Size(); ++k) {
+
+            for (indexType gap = polynom.Exponent(k) - exponent, j = 0; gap != 0; gap >>= 1, ++j) {
+                if (j == squares.size()) {
+                    squares.push_back(squares.back() * squares.back());
+                    square_error.push_back(2 * square_error.back() + operation);
+                }
+                if ((gap & 1) != 0) {
+                    power = power * squares[j];
+                    power_error += square_error[j] + operation;
+                }
+            }
+            exponent = polynom.Exponent(k);
+
+            const ReturnStruct<T> p = TwoProductFMA(polynom[k], power.hi);
+            const ReturnStruct<T> s = TwoSum(sum, p.result);
+
+            sum = s.result;
+            error += (p.error + s.error) + polynom[k] * power.lo;
+
+            if constexpr (WithBound) {
+                abs_sum += std::abs(p.result) * (1 + power_error);
+            }
+        }
+
+        BoundStruct<T> out;
+        out.result = sum + error;
+
+        if constexpr (WithBound) {
+            const T gamma = Gamma<T>(2 * polynom.Size() + 2);
+            out.bound = UnitRoundoff<T>() * std::abs(out.result) +
+                        (2 * gamma * gamma + power_error) * abs_sum * (1 + gamma);
+        }
+
+        return out;
+    }
+}
+
+/**
+ * Compensated evaluation of the sparse polynom, the cost is O(terms * log(degree))
+ * @tparam T floating point type
+ * @param polynom sparse polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<typename T>
+T CompensatedHorner(const SparsePolynom<T> &polynom, const T &x) {
+    return Detail::SparseCompensatedHorner<false>(polynom, x).result;
+}
+
+/**
+ * Compensated evaluation of the sparse polynom with a priori error bound
+ * |result - p(x)| <= u * |result| + (2 * gamma_{2K+2} ^ 2 + e) * sum of |a_k| * |x| ^ e_k
+ * where K is the number of terms and e is the relative error of the highest double-double power.
+ * Underflow and overflow of the powers are not taken into account
+ * @tparam T floating point type
+ * @param polynom sparse polynom with FP coeffs
+ * @param x value for polynom calculation
+ * @return struct: polynom value in point x and its error bound
+ */
+template<typename T>
+BoundStruct<T> CompensatedHornerWithBound(const SparsePolynom<T> &polynom, const T &x) {
+    return Detail::SparseCompensatedHorner<true>(polynom, x);
+}
+
+#endif //POLYNOMEVALUATION_SPARSEPOLYNOM_H
@@ -0,0 +1,181 @@
+#ifndef POLYNOMEVALUATION_STATICPOLYNOM_H
+#define POLYNOMEVALUATION_STATICPOLYNOM_H
+
+#include "PolynomEvaluation.h"
+
+#include <type_traits>
+
+/**
+ * Polynom with compile-time coeffs c_0, ..., c_N as non-type template parameters: the kernels are unrolled,
+ * the coeffs become immediates, steps with zero coeffs and a leading coeff of -+1 are folded away
+ * @tparam Coeffs coeffs of one floating point type, from the lowest degree
+ */
+template<auto... Coeffs>
+class StaticPolynom {
+
+public:
+    using value_type = std::common_type_t<decltype(Coeffs)...>;
+
+    static_assert(sizeof...(Coeffs) > 0, "polynom without coefficients");
+    static_assert((std::is_same_v<decltype(Coeffs), value_type> && ...), "coefficients of different types");
+
+    static constexpr indexType degree = sizeof...(Coeffs) - 1;
+
+    static constexpr Containers::array<value_type, degree + 1> coeffs = {Coeffs...};
+
+    /**
+     * Veltkamp splits of the coeffs for Dekker's product
+     */
+    static constexpr Containers::array<ReturnStruct<value_type>, degree + 1> splits = {Split(Coeffs)...};
+
+    constexpr const value_type &operator[](const indexType &i) const {
+        return coeffs[i];
+    }
+
+    constexpr operator Polynom<value_type, degree>() const {
+        return Polynom<value_type, degree>(coeffs);
+    }
+};
+
+namespace Detail {
+
+    /**
+     * Horner steps I, ..., 0 after the leading one: sum * x + c_I, the addition is dropped for c_I = 0
+     */
+    template<typename P, indexType I, typename T>
+    [[gnu::always_inline]] inline T StaticHornerStep(const T &sum, const T &x) {
+
+        constexpr T a = P::coeffs[I];
+
+        T next;
+        if constexpr (a == 0) {
+            next = sum * x;
+        } else {
+            next = sum * x + a;
+        }
+
+        if constexpr (I == 0) {
+            return next;
+        } else {
+            return StaticHornerStep<P, I - 1>(next, x);
+        }
+    }
+
+    /**
+     * Exact product of the leading coeff and x, the coeff split is precomputed for Dekker's product
+     */
+    template<typename P, typename T>
+    [[gnu::always_inline]] inline ReturnStruct<T>
+    StaticLeadingProduct(const T &x, [[maybe_unused]] const ReturnStruct<T> &x_split) {
+
+        constexpr T a = P::coeffs[P::degree];
+
+        if constexpr (a == 1) {
+            return {x, 0};
+        } else if constexpr (a == -1) {
+            return {-x, 0};
+        } else if constexpr (FloatTraits<T>::has_fma) {
+            return TwoProductFMA(a, x);
+        } else {
+            return TwoProduct(a, P::splits[P::degree], x);
+        }
+    }
+
+    /**
+     * Compensated Horner steps I, ..., 0, as in CompensatedHorner: p + c_I is error-free for c_I = 0,
+     * without FMA the split of x is reused by every product
+     */
+    template<typename P, indexType I, typename T>
+    [[gnu::always_inline]] inline T StaticCompensatedStep(const ReturnStruct<T> &p, const T &error, const T &x,
+                                                          const ReturnStruct<T> &x_split) {
+
+        constexpr T a = P::coeffs[I];
+
+        T sum, next_error;
+        if constexpr (a == 0) {
+            sum = p.result;
+            next_error = I + 1 == P::degree ? p.error : error * x + p.error;
+        } else {
+            const ReturnStruct<T> s = TwoSum(p.result, a);
+            sum = s.result;
+            next_error = I + 1 == P::degree ? p.error + s.error : error * x + (p.error + s.error);
+        }
+
+        if constexpr (I == 0) {
+            return sum + next_error;
+        } else {
+            if constexpr (FloatTraits<T>::has_fma) {
+                return StaticCompensatedStep<P, I - 1>(TwoProductFMA(sum, x), next_error, x, x_split);
+            } else {
+                return StaticCompensatedStep<P, I - 1>(TwoProduct(x, x_split, sum), next_error, x, x_split);
+            }
+        }
+    }
+}
+
+/**
+ * Horner scheme with compile-time coeffs, results are equal to Horner of the same Polynom when both are compiled
+ * without contraction, up to the sign of zero, which the folded additions of zero coeffs keep
+ * @tparam Coeffs coeffs of one floating point type
+ * @param polynom static polynom
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<auto... Coeffs>
+typename StaticPolynom<Coeffs...>::value_type Horner(const StaticPolynom<Coeffs...> &,
+                                                     const typename StaticPolynom<Coeffs...>::value_type &x) {
+
+    using P = StaticPolynom<Coeffs...>;
+    using T = typename P::value_type;
+
+    if constexpr (P::degree == 0) {
+        return P::coeffs[0];
+    } else if constexpr (P::coeffs[P::degree] == 1 || P::coeffs[P::degree] == -1) {
+        const T leading = P::coeffs[P::degree] == 1 ? x : -x;
+
+        T sum;
+        if constexpr (P::coeffs[P::degree - 1] == 0) {
+            sum = leading;
+        } else {
+            sum = leading + P::coeffs[P::degree - 1];
+        }
+
+        if constexpr (P::degree == 1) {
+            return sum;
+        } else {
+            return Detail::StaticHornerStep<P, P::degree - 2>(sum, x);
+        }
+    } else {
+        return Detail::StaticHornerStep<P, P::degree - 1>(P::coeffs[P::degree], x);
+    }
+}
+
+/**
+ * Compensated Horner scheme with compile-time coeffs, results are equal to CompensatedHorner of the same Polynom
+ * when both are compiled without contraction, otherwise they agree within the bound of CompensatedHornerWithBound
+ * @tparam Coeffs coeffs of one floating point type
+ * @param polynom static polynom
+ * @param x value for polynom calculation
+ * @return polynom value in point x
+ */
+template<auto... Coeffs>
+typename StaticPolynom<Coeffs...>::value_type
+CompensatedHorner(const StaticPolynom<Coeffs...> &, const typename StaticPolynom<Coeffs...>::value_type &x) {
+
+    using P = StaticPolynom<Coeffs...>;
+    using T = typename P::value_type;
+
+    if constexpr (P::degree == 0) {
+        return P::coeffs[0];
+    } else {
+        ReturnStruct<T> x_split{};
+        if constexpr (!FloatTraits<T>::has_fma) {
+            x_split = Split(x);
+        }
+
+        return Detail::StaticCompensatedStep<P, P::degree - 1>(Detail::StaticLeadingProduct<P>(x, x_split), T(0), x,
+                                                               x_split);
+    }
+}
+
+#endif //POLYNOMEVALUATION_STATICPOLYNOM_H
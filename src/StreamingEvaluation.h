@@ -0,0 +1,86 @@
+#ifndef POLYNOMEVALUATION_STREAMINGEVALUATION_H
+#define POLYNOMEVALUATION_STREAMINGEVALUATION_H
+
+#include "BatchEvaluation.h"
+#include "MappedFile.h"
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Number of points in one chunk of the streaming evaluator: input and output of a chunk fit in L1/L2
+ */
+constexpr indexType StreamingChunkPoints = 4096;
+
+/**
+ * Streaming compensated Horner scheme: the binary file of points is mapped and evaluated chunk by chunk
+ * straight into the mapped output file, no intermediate copies are made.
+ * Read, evaluation and write overlap: while chunk k is evaluated, read-ahead of chunk k + 1 is requested,
+ * write back of chunk k - 1 is started and its input pages are released
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param input_path binary file of points of type T in native byte order
+ * @param output_path binary file for the polynom values, created or truncated
+ * @param threads number of threads, every thread takes every threads-th chunk
+ * @return number of evaluated points
+ */
+template<typename T, indexType N>
+indexType StreamingCompensatedHorner(const Polynom<T, N> &polynom, const std::string &input_path,
+                                     const std::string &output_path, const indexType threads = 1) {
+
+    const MappedFile input(input_path);
+
+    if (input.Size() % sizeof(T) != 0) {
+        throw std::invalid_argument("size of " + input_path + " is not a multiple of the point size");
+    }
+
+    const indexType size = input.Size() / sizeof(T);
+    MappedFile output(output_path, input.Size());
+
+    const T *x = static_cast<const T *>(input.Data());
+    T *out = static_cast<T *>(output.Data());
+
+    input.Advise(0, input.Size(), MADV_SEQUENTIAL);
+
+    const indexType workers = std::max<indexType>(threads, 1);
+    const indexType chunk_bytes = StreamingChunkPoints * sizeof(T);
+    const indexType chunks = (size + StreamingChunkPoints - 1) / StreamingChunkPoints;
+
+    auto worker = [&](const indexType first_chunk) {
+        for (indexType chunk = first_chunk; chunk < chunks; chunk += workers) {
+
+            const indexType begin = chunk * StreamingChunkPoints;
+            const indexType end = std::min(begin + StreamingChunkPoints, size);
+
+            input.Advise((chunk + workers) * chunk_bytes, (chunk + workers + 1) * chunk_bytes, MADV_WILLNEED);
+
+            CompensatedHornerBatch(polynom, x + begin, end - begin, out + begin);
+
+            if (chunk >= workers) {
+                output.FlushAsync((chunk - workers) * chunk_bytes, (chunk - workers + 1) * chunk_bytes);
+                input.Advise((chunk - workers) * chunk_bytes, (chunk - workers + 1) * chunk_bytes, MADV_DONTNEED);
+            }
+        }
+    };
+
+    if (workers == 1) {
+        worker(0);
+    } else {
+        std::vector<std::thread> pool;
+        for (indexType t = 0; t < workers; ++t) {
+            pool.emplace_back(worker, t);
+        }
+        for (auto &thread: pool) {
+            thread.join();
+        }
+    }
+
+    return size;
+}
+
+#endif //POLYNOMEVALUATION_STREAMINGEVALUATION_H
@@ -0,0 +1,217 @@
+#ifndef POLYNOMEVALUATION_TAYLOREXPANSION_H
+#define POLYNOMEVALUATION_TAYLOREXPANSION_H
+
+#include "PolynomEvaluation.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Number of points expanded together by the batched Taylor kernels
+ */
+constexpr indexType TaylorBatchWidth = 4;
+
+/**
+ * Taylor coeffs t_j = p^(j)(x) / j! of the polynom in x and their error bounds
+ */
+template<typename T, indexType K>
+struct TaylorStruct {
+    Containers::array<T, K + 1> coeffs;
+    Containers::array<T, K + 1> bound;
+};
+
+/**
+ * Taylor coeffs by repeated synthetic division (Shaw, Traub), O(N * K)
+ * @tparam K highest derivative
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x expansion point
+ * @return Taylor coeffs t_0, ..., t_K, p^(j)(x) = j! * t_j
+ */
+template<indexType K, typename T, indexType N>
+Containers::array<T, K + 1> TaylorExpansion(const Polynom<T, N> &polynom, const T &x) {
+
+    static_assert(K <= N, "derivative order exceeds the degree");
+
+    Polynom<T, N> sum = polynom;
+    Containers::array<T, K + 1> out;
+
+    for (indexType j = 0; j < K + 1; ++j) {
+        for (indexType i = N; i > j; i--) {
+            sum[i - 1] = sum[i] * x + sum[i - 1];
+        }
+        out[j] = sum[j];
+    }
+
+    return out;
+}
+
+namespace Detail {
+
+    /**
+     * Repeated compensated synthetic division in place for Width points: level j is the step of Deflate
+     * on the quotient and correction left by level j - 1, so t_j is its remainder and results are equal to chained
+     * Deflate. The bound uses the Taylor coeffs of sum |a_i| * y ^ i in |x| from the same pass
+     */
+    template<bool WithBound, indexType K, indexType Width, typename T, indexType N>
+    [[gnu::always_inline]] inline void CompensatedTaylorBlock(const Polynom<T, N> &polynom, const T *x,
+                                                              Containers::array<T, K + 1> *out,
+                                                              Containers::array<T, K + 1> *bound) {
+
+        T sum[N + 1][Width], correction[N + 1][Width], abs_sum[N + 1][Width];
+
+        for (indexType i = 0; i < N + 1; ++i) {
+            for (indexType k = 0; k < Width; ++k) {
+                sum[i][k] = polynom[i];
+                correction[i][k] = 0;
+                if constexpr (WithBound) {
+                    abs_sum[i][k] = std::abs(polynom[i]);
+                }
+            }
+        }
+
+        for (indexType j = 0; j < K + 1; ++j) {
+            for (indexType i = N; i > j; i--) {
+                for (indexType k = 0; k < Width; ++k) {
+
+                    const ReturnStruct<T> p = TwoProductFMA(sum[i][k], x[k]);
+                    const ReturnStruct<T> s = TwoSum(p.result, sum[i - 1][k]);
+
+                    sum[i - 1][k] = s.result;
+                    correction[i - 1][k] = correction[i][k] * x[k] + ((p.error + s.error) + correction[i - 1][k]);
+
+                    if constexpr (WithBound) {
+                        abs_sum[i - 1][k] = abs_sum[i][k] * std::abs(x[k]) + abs_sum[i - 1][k];
+                    }
+                }
+            }
+
+            for (indexType k = 0; k < Width; ++k) {
+                out[k][j] = sum[j][k] + correction[j][k];
+            }
+        }
+
+        if constexpr (WithBound) {
+            const T u = UnitRoundoff<T>();
+            const T gamma = Gamma<T>(4 * N + 2);
+
+            for (indexType j = 0; j < K + 1; ++j) {
+                for (indexType k = 0; k < Width; ++k) {
+                    bound[k][j] = (u * std::abs(out[k][j]) + 2 * gamma * gamma * abs_sum[j][k] *
+                                                             (1 + Gamma<T>(2 * N + 1))) / (1 - u);
+                }
+            }
+        }
+    }
+
+    template<bool WithBound, indexType K, typename T, indexType N>
+    void CompensatedTaylorKernel(const Polynom<T, N> &polynom, const T *x, const indexType size,
+                                 Containers::array<T, K + 1> *out, Containers::array<T, K + 1> *bound) {
+
+        for (indexType begin = 0; begin < size; begin += TaylorBatchWidth) {
+            if (begin + TaylorBatchWidth <= size) {
+                CompensatedTaylorBlock<WithBound, K, TaylorBatchWidth>(polynom, x + begin, out + begin,
+                                                                       WithBound ? bound + begin : bound);
+            } else {
+                for (indexType i = begin; i < size; ++i) {
+                    CompensatedTaylorBlock<WithBound, K, 1>(polynom, x + i, out + i, WithBound ? bound + i : bound);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Compensated Taylor coeffs, each as accurate as repeated synthetic division in twice the working precision
+ * @tparam K highest derivative
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x expansion point
+ * @return Taylor coeffs t_0, ..., t_K, t_0 equals CompensatedHorner(polynom, x) when both are compiled
+ * without contraction
+ */
+template<indexType K, typename T, indexType N>
+Containers::array<T, K + 1> CompensatedTaylorExpansion(const Polynom<T, N> &polynom, const T &x) {
+
+    static_assert(K <= N, "derivative order exceeds the degree");
+
+    Containers::array<T, K + 1> out;
+    Detail::CompensatedTaylorBlock<false, K, 1>(polynom, &x, &out,
+                                                static_cast<Containers::array<T, K + 1> *>(nullptr));
+    return out;
+}
+
+/**
+ * Compensated Taylor coeffs with a priori error bounds
+ * |result_j - t_j| <= (u * |result_j| + 2 * gamma_{4N+2} ^ 2 * sum of C(i, j) * |a_i| * |x| ^ (i - j)) / (1 - u),
+ * the sum is the Taylor coeff of the polynom with |a_i| in |x|. Underflow is not taken into account
+ * @tparam K highest derivative
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x expansion point
+ * @return struct: Taylor coeffs and their error bounds
+ */
+template<indexType K, typename T, indexType N>
+TaylorStruct<T, K> CompensatedTaylorExpansionWithBound(const Polynom<T, N> &polynom, const T &x) {
+
+    static_assert(K <= N, "derivative order exceeds the degree");
+
+    TaylorStruct<T, K> out;
+    Detail::CompensatedTaylorBlock<true, K, 1>(polynom, &x, &out.coeffs, &out.bound);
+    return out;
+}
+
+/**
+ * Compensated Taylor coeffs for many points, TaylorBatchWidth at a time. Results are equal to
+ * CompensatedTaylorExpansion
+ * @tparam K highest derivative
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x expansion points
+ * @param size number of points
+ * @param out Taylor coeffs per point
+ */
+template<indexType K, typename T, indexType N>
+void CompensatedTaylorExpansionBatch(const Polynom<T, N> &polynom, const T *x, const indexType size,
+                                     Containers::array<T, K + 1> *out) {
+
+    static_assert(K <= N, "derivative order exceeds the degree");
+
+    Detail::CompensatedTaylorKernel<false, K>(polynom, x, size, out,
+                                              static_cast<Containers::array<T, K + 1> *>(nullptr));
+}
+
+/**
+ * Compensated Taylor coeffs with error bounds for many points
+ * @tparam K highest derivative
+ * @tparam T floating point type
+ * @tparam N polynom degree
+ * @param polynom polynom with FP coeffs
+ * @param x expansion points
+ * @param size number of points
+ * @param out Taylor coeffs and error bounds per point
+ */
+template<indexType K, typename T, indexType N>
+void CompensatedTaylorExpansionWithBoundBatch(const Polynom<T, N> &polynom, const T *x, const indexType size,
+                                              TaylorStruct<T, K> *out) {
+
+    static_assert(K <= N, "derivative order exceeds the degree");
+
+    for (indexType begin = 0; begin < size; begin += TaylorBatchWidth) {
+        const indexType width = std::min(TaylorBatchWidth, size - begin);
+
+        Containers::array<T, K + 1> coeffs[TaylorBatchWidth], bound[TaylorBatchWidth];
+        Detail::CompensatedTaylorKernel<true, K>(polynom, x + begin, width, coeffs, bound);
+
+        for (indexType k = 0; k < width; ++k) {
+            out[begin + k].coeffs = coeffs[k];
+            out[begin + k].bound = bound[k];
+        }
+    }
+}
+
+#endif //POLYNOMEVALUATION_TAYLOREXPANSION_H
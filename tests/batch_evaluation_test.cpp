@@ -0,0 +1,89 @@
+#include "../src/BatchEvaluation.h"
+#include <gtest/gtest.h>
+
+/*
+ * (x - 1) ^ 5 * (x - 5) ^ 5 on the points of TEST_2 and a few more to leave a tail after the full blocks
+ */
+
+class BatchEvaluationTest : public ::testing::Test {
+protected:
+    const Polynom<scalar, 10> polynom{{3125, -18750, 48125, -69000, 60650, -33876, 12130, -2760, 385, -30, 1}};
+    Containers::array<scalar, 103> test_points;
+
+    void SetUp() override {
+        for (indexType i = 0; i < test_points.size(); ++i) {
+            test_points[i] = 0.97 + 0.00029 * static_cast<scalar>(i);
+        }
+    }
+
+    void TearDown() override {
+        SetInstructionSet(InstructionSet::AVX512);
+    }
+};
+
+TEST_F(BatchEvaluationTest, TWO_PRODUCT) {
+
+    for (indexType i = 0; i < test_points.size(); ++i) {
+        const scalar a = test_points[i] * 12345.678;
+        const scalar b = 1 / test_points[i];
+
+        ReturnStruct<scalar> dekker = TwoProduct(a, b);
+        ReturnStruct<scalar> fma = TwoProductFMA(a, b);
+
+        ASSERT_EQ(fma.result, dekker.result);
+        ASSERT_EQ(fma.error, dekker.error);
+    }
+}
+
+TEST_F(BatchEvaluationTest, WITHOUT_FMA) {
+
+    for (const InstructionSet instruction_set: {InstructionSet::Scalar, InstructionSet::SSE2}) {
+
+        ASSERT_EQ(instruction_set, SetInstructionSet(instruction_set));
+
+        Containers::array<scalar, 103> horner_results, compensated_horner_results, bounds;
+        HornerBatch(polynom, test_points.data(), test_points.size(), horner_results.data());
+        CompensatedHornerBatch(polynom, test_points.data(), test_points.size(), compensated_horner_results.data());
+        CompensatedHornerWithBoundBatch(polynom, test_points.data(), test_points.size(),
+                                        compensated_horner_results.data(), bounds.data());
+
+        for (indexType i = 0; i < test_points.size(); ++i) {
+            BoundStruct<scalar> reference = CompensatedHornerWithBound(polynom, test_points[i]);
+#if defined(__FP_FAST_FMA)
+            /*
+             * builds for FMA targets contract the references and the Scalar kernel uses fma:
+             * the kernels stay within the error bounds
+             */
+            scalar condition = 0;
+            for (indexType k = 11; k >= 1; k--) {
+                condition = condition * std::abs(test_points[i]) + std::abs(polynom[k - 1]);
+            }
+            ASSERT_NEAR(reference.result, horner_results[i], 2 * Gamma<scalar>(20) * condition);
+            ASSERT_NEAR(reference.result, compensated_horner_results[i], 2 * reference.bound);
+            ASSERT_NEAR(reference.bound, bounds[i], 1e-3 * reference.bound);
+#else
+            ASSERT_EQ(Horner(polynom, test_points[i]), horner_results[i]);
+            ASSERT_EQ(reference.result, compensated_horner_results[i]);
+            ASSERT_EQ(reference.bound, bounds[i]);
+#endif
+        }
+    }
+}
+
+TEST_F(BatchEvaluationTest, DETECTED) {
+
+    /*
+     * FMA kernels may fuse the update of the correction term, both results stay within the error bound of the exact value
+     */
+
+    const InstructionSet instruction_set = SetInstructionSet(DetectInstructionSet());
+    ASSERT_EQ(DetectInstructionSet(), instruction_set);
+
+    Containers::array<scalar, 103> compensated_horner_results;
+    CompensatedHornerBatch(polynom, test_points.data(), test_points.size(), compensated_horner_results.data());
+
+    for (indexType i = 0; i < test_points.size(); ++i) {
+        const BoundStruct<scalar> reference = CompensatedHornerWithBound(polynom, test_points[i]);
+        ASSERT_NEAR(reference.result, compensated_horner_results[i], 2 * reference.bound);
+    }
+}
@@ -0,0 +1,108 @@
+#include "../src/BernsteinPolynom.h"
+#include "../src/ExpansionArithmetic.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+/*
+ * b_i = (-1) ^ i - 2 ^ -22 is (1 - 2 * t) ^ N - 2 ^ -22 in Bernstein basis, the sum of |b_i| * B_i(t) is about 1,
+ * so for N = 11 near the root t = 3 / 8 the condition number is about 1 / |p(t)|.
+ * The reference is de Casteljau in expansion arithmetic with 1 - t split exactly by TwoSum
+ */
+
+template<indexType N>
+BernsteinPolynom<scalar, N> AlternatingPolynom() {
+    BernsteinPolynom<scalar, N> polynom;
+    for (indexType i = 0; i < N + 1; ++i) {
+        polynom[i] = (i % 2 == 0 ? 1 : -1) - std::ldexp(1., -22);
+    }
+    return polynom;
+}
+
+template<indexType N>
+scalar ExactError(const BernsteinPolynom<scalar, N> &polynom, const scalar &t, const scalar &value) {
+
+    Expansion<scalar> r;
+    GrowExpansion(Expansion<scalar>{1}, -t, r);
+
+    std::vector<Expansion<scalar>> b;
+    for (indexType i = 0; i < N + 1; ++i) {
+        b.push_back(polynom[i] == 0 ? Expansion<scalar>{} : Expansion<scalar>{polynom[i]});
+    }
+
+    for (indexType j = 1; j < N + 1; ++j) {
+        for (indexType i = 0; i + j < N + 1; ++i) {
+            Expansion<scalar> scaled;
+            ScaleExpansion(b[i + 1], t, scaled);
+            b[i] = ExpansionSum(ExpansionProduct(r, b[i]), scaled);
+            CompressExpansion(b[i]);
+        }
+    }
+
+    Expansion<scalar> difference;
+    GrowExpansion(b[0], -value, difference);
+    return std::abs(ExpansionEstimate(difference));
+}
+
+TEST(BERNSTEIN_POLYNOM, WELL_CONDITIONED) {
+
+    BernsteinPolynom<scalar, 4> polynom({1, 2, -0.5, 3, 0.25});
+
+    ASSERT_EQ(1, DeCasteljau(polynom, 0.));
+    ASSERT_EQ(0.25, DeCasteljau(polynom, 1.));
+    ASSERT_EQ(1, CompensatedDeCasteljau(polynom, 0.));
+    ASSERT_EQ(0.25, CompensatedDeCasteljau(polynom, 1.));
+
+    for (indexType i = 0; i < 100; ++i) {
+        const scalar t = 0.01 * static_cast<scalar>(i);
+        ASSERT_NEAR(DeCasteljau(polynom, t), CompensatedDeCasteljau(polynom, t), 1e-14);
+    }
+}
+
+TEST(BERNSTEIN_POLYNOM, ILL_CONDITIONED) {
+
+    constexpr indexType N = 11;
+    const BernsteinPolynom<scalar, N> polynom = AlternatingPolynom<N>();
+
+    scalar naive_error = 0, compensated_error = 0;
+
+    for (indexType k = 0; k < 200; ++k) {
+        const scalar t = 0.375 + 1.3e-9 * (static_cast<scalar>(k) - 100);
+
+        const BoundStruct<scalar> value = CompensatedDeCasteljauWithBound(polynom, t);
+        const scalar error = ExactError(polynom, t, value.result);
+
+        ASSERT_EQ(value.result, CompensatedDeCasteljau(polynom, t));
+        ASSERT_LE(error, value.bound);
+        ASSERT_LE(value.bound, 1e-28 + 4 * UnitRoundoff<scalar>() * std::abs(value.result));
+
+        naive_error = std::max(naive_error, ExactError(polynom, t, DeCasteljau(polynom, t)));
+        compensated_error = std::max(compensated_error, error);
+    }
+
+    ASSERT_LT(compensated_error * 1e6, naive_error);
+}
+
+TEST(BERNSTEIN_POLYNOM, BATCH) {
+
+    constexpr indexType N = 7;
+    const BernsteinPolynom<scalar, N> polynom = AlternatingPolynom<N>();
+
+    std::vector<scalar> t;
+    for (indexType k = 0; k < 1003; ++k) {
+        t.push_back(0.25 + 7.3e-4 * static_cast<scalar>(k));
+    }
+
+    std::vector<scalar> out(t.size()), bounded(t.size()), bound(t.size());
+    CompensatedDeCasteljauBatch(polynom, t.data(), t.size(), out.data());
+    CompensatedDeCasteljauWithBoundBatch(polynom, t.data(), t.size(), bounded.data(), bound.data());
+
+    for (indexType k = 0; k < t.size(); ++k) {
+        const BoundStruct<scalar> value = CompensatedDeCasteljauWithBound(polynom, t[k]);
+
+        ASSERT_EQ(value.result, out[k]);
+        ASSERT_EQ(value.result, bounded[k]);
+        ASSERT_EQ(value.bound, bound[k]);
+        ASSERT_LE(ExactError(polynom, t[k], out[k]), bound[k]);
+    }
+}
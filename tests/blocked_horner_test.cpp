@@ -0,0 +1,168 @@
+#include "../src/BlockedHorner.h"
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+/*
+ * Degree 40000 with coeffs in [-1, 1], more than 39 blocks, and a number of points that is not a multiple
+ * of BlockedHornerPoints
+ */
+
+/*
+ * Horner scheme compiled without contraction, as the kernels with Dekker's products
+ */
+
+POLYNOMEVALUATION_NO_CONTRACT
+scalar UnfusedHorner(const PolynomView<scalar> &polynom, const scalar x) {
+    scalar s = polynom[polynom.Degree()];
+    for (indexType i = polynom.Degree(); i >= 1; i--) {
+        s = s * x + polynom[i - 1];
+    }
+    return s;
+}
+
+scalar Condition(const PolynomView<scalar> &polynom, const scalar x) {
+    scalar condition = 0;
+    for (indexType i = polynom.Degree() + 1; i >= 1; i--) {
+        condition = condition * std::abs(x) + std::abs(polynom[i - 1]);
+    }
+    return condition;
+}
+
+/*
+ * Kernels without fma equal the unfused references, CompensatedHorner is unfused where the build has no fast fma.
+ * Otherwise Horner stays within gamma_2N * Horner(|a|, |x|) and compensated Horner within
+ * u * |p| + gamma_{4N+2} ^ 2 * Horner(|a|, |x|)
+ */
+
+::testing::AssertionResult HornerMatches(const PolynomView<scalar> &polynom, const scalar x, const scalar value,
+                                         const bool fused) {
+
+    const scalar reference = UnfusedHorner(polynom, x);
+    const scalar bound = 2 * Gamma<scalar>(2 * polynom.Degree()) * Condition(polynom, x);
+
+    if (fused ? std::abs(reference - value) <= bound : reference == value) {
+        return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure() << "Horner " << reference << ", kernel " << value;
+}
+
+::testing::AssertionResult CompensatedMatches(const PolynomView<scalar> &polynom, const scalar x, const scalar value,
+                                              const bool fused) {
+
+    const scalar reference = CompensatedHorner(polynom, x);
+    const scalar gamma = Gamma<scalar>(4 * polynom.Degree() + 2);
+    const scalar bound = 2 * UnitRoundoff<scalar>() * std::abs(reference) +
+                         2 * gamma * gamma * Condition(polynom, x);
+
+    if (fused || FloatTraits<scalar>::has_fma ? std::abs(reference - value) <= bound : reference == value) {
+        return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure() << "CompensatedHorner " << reference << ", kernel " << value;
+}
+
+class BlockedHornerTest : public ::testing::Test {
+protected:
+    std::vector<scalar> coeffs, points;
+
+    std::uint64_t state = 2024;
+
+    scalar Random() {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return static_cast<scalar>(state >> 11) * std::ldexp(1., -53);
+    }
+
+    void SetUp() override {
+        for (indexType i = 0; i < 40001; ++i) {
+            coeffs.push_back(2 * Random() - 1);
+        }
+        for (indexType i = 0; i < 37; ++i) {
+            points.push_back(2 * Random() - 1);
+        }
+        points.push_back(1);
+        points.push_back(-1);
+    }
+
+    void TearDown() override {
+        SetInstructionSet(InstructionSet::AVX512);
+    }
+};
+
+TEST_F(BlockedHornerTest, WITHOUT_FMA) {
+
+    const PolynomView<scalar> polynom(coeffs.data(), coeffs.size() - 1);
+
+    for (const InstructionSet instruction_set: {InstructionSet::Scalar, InstructionSet::SSE2}) {
+
+        ASSERT_EQ(instruction_set, SetInstructionSet(instruction_set));
+
+        std::vector<scalar> out(points.size()), compensated(points.size());
+        BlockedHornerBatch(polynom, points.data(), points.size(), out.data());
+        BlockedCompensatedHornerBatch(polynom, points.data(), points.size(), compensated.data());
+
+        // the Scalar kernel takes fma where the build has a fast one
+        const bool fused = instruction_set == InstructionSet::Scalar && FloatTraits<scalar>::has_fma;
+
+        for (indexType j = 0; j < points.size(); ++j) {
+            ASSERT_TRUE(HornerMatches(polynom, points[j], out[j], fused));
+            ASSERT_TRUE(CompensatedMatches(polynom, points[j], compensated[j], fused));
+        }
+    }
+}
+
+TEST_F(BlockedHornerTest, DETECTED) {
+
+    /*
+     * FMA kernels fuse the Horner steps and the correction update: Horner stays within its a priori bound,
+     * compensated Horner within the bound u * |p| + gamma_{4N+2} ^ 2 * Horner(|a|, |x|)
+     */
+
+    SetInstructionSet(DetectInstructionSet());
+
+    const PolynomView<scalar> polynom(coeffs.data(), coeffs.size() - 1);
+    std::vector<scalar> abs_coeffs(coeffs.size());
+    for (indexType i = 0; i < coeffs.size(); ++i) {
+        abs_coeffs[i] = std::abs(coeffs[i]);
+    }
+
+    std::vector<scalar> out(points.size()), compensated(points.size());
+    BlockedHornerBatch(polynom, points.data(), points.size(), out.data());
+    BlockedCompensatedHornerBatch(polynom, points.data(), points.size(), compensated.data());
+
+    const scalar gamma = Gamma<scalar>(4 * polynom.Degree() + 2);
+
+    for (indexType j = 0; j < points.size(); ++j) {
+        const scalar condition = Horner(PolynomView<scalar>(abs_coeffs.data(), polynom.Degree()), std::abs(points[j]));
+        const scalar reference = CompensatedHorner(polynom, points[j]);
+
+        ASSERT_NEAR(reference, out[j], 2 * Gamma<scalar>(2 * polynom.Degree()) * condition);
+        ASSERT_NEAR(reference, compensated[j], 2 * UnitRoundoff<scalar>() * std::abs(reference) +
+                                               2 * gamma * gamma * condition);
+    }
+}
+
+TEST_F(BlockedHornerTest, SHORT_POLYNOM) {
+
+/*
+ * (x - 7) ^ 8: a single block
+ */
+
+    SetInstructionSet(InstructionSet::Scalar);
+
+    Polynom<scalar, 8> polynom({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+    std::vector<scalar> out(points.size()), compensated(points.size());
+
+    BlockedHornerBatch(polynom, points.data(), points.size(), out.data());
+    BlockedCompensatedHornerBatch(polynom, points.data(), points.size(), compensated.data());
+
+    for (indexType j = 0; j < points.size(); ++j) {
+        ASSERT_TRUE(HornerMatches(PolynomView<scalar>(polynom), points[j], out[j], FloatTraits<scalar>::has_fma));
+        ASSERT_TRUE(CompensatedMatches(PolynomView<scalar>(polynom), points[j], compensated[j],
+                                       FloatTraits<scalar>::has_fma));
+    }
+
+    Polynom<scalar, 0> constant({3});
+    BlockedCompensatedHornerBatch(constant, points.data(), points.size(), out.data());
+    ASSERT_EQ(3, out[0]);
+}
@@ -0,0 +1,134 @@
+#include "../src/CoefficientSet.h"
+#include "../src/PowerTable.h"
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+std::filesystem::path UniqueTempPath(const std::string &prefix) {
+    std::string path = (std::filesystem::temp_directory_path() / (prefix + "XXXXXX")).string();
+    const int descriptor = ::mkstemp(path.data());
+    if (descriptor >= 0) {
+        ::close(descriptor);
+    }
+    return path;
+}
+
+/*
+ * Builds for FMA targets contract the Polynom and the view kernels differently: their values agree
+ * within the bound of CompensatedHornerWithBound, and exactly otherwise
+ */
+
+template<indexType N>
+::testing::AssertionResult SameCompensatedValue(const Polynom<scalar, N> &polynom, const PolynomView<scalar> &view,
+                                                const scalar x) {
+
+    const BoundStruct<scalar> reference = CompensatedHornerWithBound(polynom, x);
+    const scalar value = CompensatedHorner(view, x);
+#if defined(__FP_FAST_FMA)
+    if (std::abs(reference.result - value) <= 2 * reference.bound) {
+        return ::testing::AssertionSuccess();
+    }
+#else
+    if (reference.result == value) {
+        return ::testing::AssertionSuccess();
+    }
+#endif
+    return ::testing::AssertionFailure() << "polynom " << reference.result << ", view " << value;
+}
+
+class CoefficientSetTest : public ::testing::Test {
+protected:
+    const Polynom<scalar, 10> first{{1, -10, 45, -120, 210, -252, 210, -120, 45, -10, 1}};
+    const Polynom<scalar, 1> second{{-5, 5}};
+    const Polynom<scalar, 8> third{{5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1}};
+
+    std::filesystem::path path = UniqueTempPath("polynom_coefficient_set_");
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(CoefficientSetTest, ZERO_COPY_EVALUATION) {
+
+    WriteCoefficientSet<scalar>(path.string(), {first, second, third});
+
+    CoefficientSet coefficient_set(path.string());
+
+    ASSERT_EQ(3, coefficient_set.Size());
+    ASSERT_EQ(10, coefficient_set.Degree(0));
+    ASSERT_EQ(CoefficientType::Float64, coefficient_set.Type(2));
+
+    const StoredPolynomView<scalar> first_view = coefficient_set.View<scalar>(0);
+    const StoredPolynomView<scalar> third_view = coefficient_set.View<scalar>(2);
+
+    ASSERT_FALSE(first_view.HasSplits());
+    ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(third_view.coeffs.Data()) % CoefficientSetAlignment);
+
+    for (indexType i = 0; i < 100; ++i) {
+        const scalar x = 0.95 + 0.001 * i;
+        const scalar y = 6.95 + 0.001 * i;
+        ASSERT_TRUE(SameCompensatedValue(first, first_view.coeffs, x));
+        ASSERT_EQ(Horner(first, x), Horner(first_view.coeffs, x));
+        ASSERT_TRUE(SameCompensatedValue(third, third_view.coeffs, y));
+        ASSERT_TRUE(SameCompensatedValue(second, coefficient_set.View<scalar>(1).coeffs, x));
+    }
+}
+
+TEST_F(CoefficientSetTest, SPLITS) {
+
+    WriteCoefficientSet<scalar>(path.string(), {third}, true);
+
+    CoefficientSet coefficient_set(path.string());
+    const StoredPolynomView<scalar> view = coefficient_set.View<scalar>(0);
+
+    ASSERT_TRUE(view.HasSplits());
+    for (indexType i = 0; i < 9; ++i) {
+        ASSERT_EQ(third[i], view.split_high[i] + view.split_low[i]);
+        ASSERT_EQ(Split(third[i]).result, view.split_high[i]);
+    }
+
+/*
+ * Dekker's products with the stored splits give the values of TwoProductFMA in builds without FMA.
+ * x - 7 is exact, (x - 7) ^ 8 is within 8u of the exact value
+ */
+
+    std::vector<scalar> x(100), expected(100), bound(100), result(100);
+    for (indexType i = 0; i < 100; ++i) {
+        x[i] = 6.95 + 0.001 * i;
+    }
+
+    const PowerTable<scalar, 8> table(x.data(), x.size());
+    table.EvaluateWithBound(third, expected.data(), bound.data());
+    table.Evaluate(view.coeffs, view.split_high, view.split_low, result.data());
+
+    for (indexType i = 0; i < 100; ++i) {
+        const scalar exact = std::pow(x[i] - 7, 8);
+        ASSERT_NEAR(exact, result[i], bound[i] + 8 * UnitRoundoff<scalar>() * std::abs(exact));
+#if !defined(__FP_FAST_FMA)
+        ASSERT_EQ(expected[i], result[i]);
+#endif
+    }
+}
+
+TEST_F(CoefficientSetTest, INVALID_FILES) {
+
+    WriteCoefficientSet<scalar>(path.string(), {second});
+    ASSERT_THROW(CoefficientSet(path.string()).View<float>(0), std::invalid_argument);
+    ASSERT_THROW(CoefficientSet(path.string()).View<scalar>(1), std::out_of_range);
+    ASSERT_THROW(CoefficientSet(path.string()).Degree(1), std::out_of_range);
+    ASSERT_THROW(CoefficientSet(path.string()).Type(1), std::out_of_range);
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        const std::vector<char> garbage(128, 'x');
+        file.write(garbage.data(), static_cast<std::streamsize>(garbage.size()));
+    }
+    ASSERT_THROW(CoefficientSet{path.string()}, std::runtime_error);
+}
@@ -0,0 +1,91 @@
+#include "../src/CompensatedSummation.h"
+#include "../src/ExpansionArithmetic.h"
+#include <gtest/gtest.h>
+
+/*
+ * Ill-conditioned data: every value is followed later by an almost opposite one,
+ * exact references are computed with expansions
+ */
+
+class CompensatedSummationTest : public ::testing::Test {
+protected:
+    std::vector<scalar> values, x, y;
+    Expansion<scalar> exact_sum = {0}, exact_dot = {0};
+
+    std::uint64_t state = 12345;
+
+    scalar Random() {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return static_cast<scalar>(state >> 11) * std::ldexp(1., -53);
+    }
+
+    static void Add(Expansion<scalar> &e, const scalar &b) {
+        Expansion<scalar> buffer;
+        GrowExpansion(e, b, buffer);
+        e.swap(buffer);
+    }
+
+    void SetUp() override {
+        const indexType half = 501;
+
+        for (indexType i = 0; i < half; ++i) {
+            const scalar value = (Random() - 0.5) * std::ldexp(1., static_cast<int>(Random() * 60) - 30);
+            values.push_back(value);
+            x.push_back(value);
+            y.push_back(Random() + 1);
+        }
+        for (indexType i = 0; i < half; ++i) {
+            values.push_back(-values[i] * (1 + std::ldexp(1., -40)));
+            x.push_back(-x[i]);
+            y.push_back(y[i] * (1 + std::ldexp(1., -45)));
+        }
+
+        for (indexType i = 0; i < values.size(); ++i) {
+            Add(exact_sum, values[i]);
+            const ReturnStruct<scalar> product = TwoProductFMA(x[i], y[i]);
+            Add(exact_dot, product.error);
+            Add(exact_dot, product.result);
+        }
+    }
+};
+
+TEST_F(CompensatedSummationTest, SUM) {
+
+    const scalar reference = ExpansionRound(exact_sum);
+
+    BoundStruct<scalar> sum2 = Sum2WithBound(values.data(), values.size());
+    ASSERT_LE(std::abs(sum2.result - reference), sum2.bound);
+    ASSERT_EQ(sum2.result, Sum2(values.data(), values.size()));
+
+    for (indexType K = 2; K <= 4; ++K) {
+        BoundStruct<scalar> sumK = SumKWithBound(values.data(), values.size(), K);
+        ASSERT_LE(std::abs(sumK.result - reference), sumK.bound);
+    }
+
+    ASSERT_EQ(reference, SumK(values.data(), values.size(), 4));
+}
+
+TEST_F(CompensatedSummationTest, DOT) {
+
+    const scalar reference = ExpansionRound(exact_dot);
+
+    BoundStruct<scalar> dot2 = Dot2WithBound(x.data(), y.data(), x.size());
+    ASSERT_LE(std::abs(dot2.result - reference), dot2.bound);
+    ASSERT_EQ(dot2.result, Dot2(x.data(), y.data(), x.size()));
+
+    for (indexType K = 2; K <= 4; ++K) {
+        BoundStruct<scalar> dotK = DotKWithBound(x.data(), y.data(), x.size(), K);
+        ASSERT_LE(std::abs(dotK.result - reference), dotK.bound);
+    }
+
+    ASSERT_EQ(reference, DotK(x.data(), y.data(), x.size(), 4));
+}
+
+TEST_F(CompensatedSummationTest, SHORT_INPUTS) {
+
+    ASSERT_EQ(0, Sum2(values.data(), 0));
+    ASSERT_EQ(0, SumK(values.data(), 0, 3));
+    ASSERT_EQ(values[0], Sum2(values.data(), 1));
+    ASSERT_EQ(x[0] * y[0], Dot2(x.data(), y.data(), 1));
+    ASSERT_EQ(x[0] * y[0], DotK(x.data(), y.data(), 1, 3));
+}
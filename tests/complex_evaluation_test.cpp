@@ -0,0 +1,85 @@
+#include "../src/ComplexEvaluation.h"
+#include <gtest/gtest.h>
+
+using complex = std::complex<scalar>;
+
+TEST(COMPLEX_EVAL, TWO_PRODUCT) {
+
+    /*
+     * (1 + 2 ^ -30 + i) ^ 2 = 2 ^ -29 + 2 ^ -60 + i * (2 + 2 ^ -29), the term 2 ^ -60 is lost by rounding
+     */
+
+    const complex a(1 + std::ldexp(1., -30), 1);
+
+    ComplexProductStruct<scalar> product = TwoProductFMA(a, a);
+    const complex error = product.error_first + product.error_second + product.error_third;
+
+    ASSERT_EQ(std::ldexp(1., -29), product.result.real());
+    ASSERT_EQ(std::ldexp(1., -60), error.real());
+    ASSERT_EQ(2 + std::ldexp(1., -29), product.result.imag());
+    ASSERT_EQ(0, error.imag());
+}
+
+TEST(COMPLEX_EVAL, ILL_CONDITIONED) {
+
+    /*
+     * (z - (1 + i)) ^ 5 in z = 1 + 2 ^ -10 + i, the exact value is 2 ^ -50
+     */
+
+    const complex root(1, 1);
+    Polynom<complex, 5> polynom({-root * root * root * root * root, complex(5) * root * root * root * root,
+                                 complex(-10) * root * root * root, complex(10) * root * root,
+                                 complex(-5) * root, complex(1)});
+
+    const complex x(1 + std::ldexp(1., -10), 1);
+    const complex reference(std::ldexp(1., -50), 0);
+
+    const complex compensated_horner_result = CompensatedHorner(polynom, x);
+
+    ASSERT_LT(std::abs(compensated_horner_result - reference) / std::abs(reference), 1e-13);
+}
+
+TEST(COMPLEX_EVAL, BATCH) {
+
+    const complex root(0.3, -0.7);
+    Polynom<complex, 4> polynom({root * root * root * root, complex(-4) * root * root * root,
+                                 complex(6) * root * root, complex(-4) * root, complex(1)});
+    SplitComplexPolynom<scalar, 4> split_polynom(polynom);
+
+    Containers::array<scalar, 13> x_real, x_imag, out_real, out_imag;
+    for (indexType i = 0; i < x_real.size(); ++i) {
+        x_real[i] = 0.3 + 0.001 * i;
+        x_imag[i] = -0.7 + 0.0007 * i;
+    }
+
+    CompensatedHornerBatch(split_polynom, x_real.data(), x_imag.data(), x_real.size(), out_real.data(),
+                           out_imag.data());
+
+    for (indexType i = 0; i < x_real.size(); ++i) {
+        const complex compensated_horner_result = CompensatedHorner(polynom, complex(x_real[i], x_imag[i]));
+        ASSERT_NEAR(compensated_horner_result.real(), out_real[i], 1e-13 * std::abs(compensated_horner_result));
+        ASSERT_NEAR(compensated_horner_result.imag(), out_imag[i], 1e-13 * std::abs(compensated_horner_result));
+    }
+}
+
+TEST(COMPLEX_EVAL, UNIT_CIRCLE) {
+
+    /*
+     * 1 + z + ... + z ^ 7 vanishes in all 8-th roots of unity except 1,
+     * the residual comes from rounding of the points themselves
+     */
+
+    Containers::array<scalar, 8> ones = {1, 1, 1, 1, 1, 1, 1, 1};
+    Containers::array<scalar, 8> zeros = {0, 0, 0, 0, 0, 0, 0, 0};
+    SplitComplexPolynom<scalar, 7> polynom(ones, zeros);
+
+    Containers::array<scalar, 8> out_real, out_imag;
+    CompensatedHornerUnitCircle(polynom, 8, out_real.data(), out_imag.data());
+
+    ASSERT_EQ(8, out_real[0]);
+    ASSERT_EQ(0, out_imag[0]);
+    for (indexType k = 1; k < 8; ++k) {
+        ASSERT_NEAR(0, out_real[k], 1e-14);
+        ASSERT_NEAR(0, out_imag[k], 1e-14);
+    }
+}
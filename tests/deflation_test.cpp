@@ -0,0 +1,119 @@
+#include "../src/Deflation.h"
+#include "../src/ExpansionArithmetic.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+/*
+ * (x - 0.1) * (x - 0.2) * ... * (x - 1) with rounded coeffs, deflated by rounded roots.
+ * The reference is synthetic division in expansion arithmetic, chained deflations divide the exact quotient
+ */
+
+constexpr indexType N = 10;
+
+std::vector<Expansion<scalar>> ExactDeflate(const std::vector<Expansion<scalar>> &polynom, const scalar &r,
+                                            Expansion<scalar> &remainder) {
+
+    std::vector<Expansion<scalar>> quotient(polynom.size() - 1);
+    Expansion<scalar> sum = polynom.back();
+
+    for (indexType i = polynom.size() - 1; i >= 1; i--) {
+        quotient[i - 1] = sum;
+
+        Expansion<scalar> scaled;
+        ScaleExpansion(sum, r, scaled);
+        sum = ExpansionSum(scaled, polynom[i - 1]);
+        CompressExpansion(sum);
+    }
+
+    remainder = sum;
+    return quotient;
+}
+
+class DeflationTest : public ::testing::Test {
+protected:
+    Polynom<scalar, N> polynom;
+    std::vector<Expansion<scalar>> exact;
+
+    void SetUp() override {
+        for (indexType i = 0; i < N + 1; ++i) {
+            polynom[i] = i == 0 ? 1 : 0;
+        }
+        for (indexType k = 1; k < N + 1; ++k) {
+            const scalar root = static_cast<scalar>(k) / 10;
+            for (indexType i = N; i >= 1; i--) {
+                polynom[i] = polynom[i - 1] - root * polynom[i];
+            }
+            polynom[0] = -root * polynom[0];
+        }
+
+        for (indexType i = 0; i < N + 1; ++i) {
+            exact.push_back({polynom[i]});
+        }
+    }
+};
+
+TEST_F(DeflationTest, SINGLE) {
+
+    for (const scalar r: {0.3, 0.7, 0.95, 1.}) {
+
+        const DeflationStruct<scalar, N - 1> deflation = Deflate(polynom, r);
+
+        Expansion<scalar> remainder;
+        const std::vector<Expansion<scalar>> quotient = ExactDeflate(exact, r, remainder);
+
+        const BoundStruct<scalar> value = CompensatedHornerWithBound(polynom, r);
+        ASSERT_NEAR(ExpansionRound(remainder), deflation.remainder, value.bound);
+        if constexpr (!FloatTraits<scalar>::has_fma) {
+            ASSERT_EQ(value.result, deflation.remainder);
+        }
+
+        scalar naive = polynom[N], naive_error = 0;
+
+        for (indexType i = N; i >= 1; i--) {
+            const scalar reference = ExpansionRound(quotient[i - 1]);
+
+            ASSERT_EQ(reference, deflation.quotient[i - 1] + deflation.correction[i - 1]);
+
+            naive_error = std::max(naive_error, std::abs(naive - reference) / std::abs(reference));
+            naive = naive * r + polynom[i - 1];
+        }
+
+        if (r != 1) {
+            ASSERT_GT(naive_error, 1e-16);
+        }
+    }
+}
+
+TEST_F(DeflationTest, CHAIN) {
+
+    const scalar roots[] = {0.3, 0.7, 0.5};
+
+    const DeflationStruct<scalar, N - 1> first = Deflate(polynom, roots[0]);
+    const DeflationStruct<scalar, N - 2> second = Deflate(first.quotient, first.correction, roots[1]);
+    const DeflationStruct<scalar, N - 3> third = Deflate(second.quotient, second.correction, roots[2]);
+
+    Expansion<scalar> remainder;
+    std::vector<Expansion<scalar>> quotient = ExactDeflate(exact, roots[0], remainder);
+    quotient = ExactDeflate(quotient, roots[1], remainder);
+
+    ASSERT_NEAR(ExpansionRound(remainder), second.remainder, 2 * UnitRoundoff<scalar>() * std::abs(second.remainder));
+
+    quotient = ExactDeflate(quotient, roots[2], remainder);
+
+    ASSERT_NEAR(ExpansionRound(remainder), third.remainder, 2 * UnitRoundoff<scalar>() * std::abs(third.remainder));
+
+    for (indexType i = 0; i < N - 2; ++i) {
+        const scalar reference = ExpansionRound(quotient[i]);
+        ASSERT_NEAR(reference, third.quotient[i] + third.correction[i], 2 * UnitRoundoff<scalar>() * std::abs(reference));
+    }
+}
+
+TEST(DEFLATION, LINEAR) {
+
+    const DeflationStruct<scalar, 0> deflation = Deflate(Polynom<scalar, 1>({-0.375, 1}), 0.125);
+
+    ASSERT_EQ(1, deflation.quotient[0]);
+    ASSERT_EQ(0, deflation.correction[0]);
+    ASSERT_EQ(-0.25, deflation.remainder);
+}
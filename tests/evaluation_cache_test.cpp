@@ -0,0 +1,168 @@
+#include "../src/EvaluationCache.h"
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(EVALUATION_CACHE, IDENTITY) {
+
+    Polynom<scalar, 2> first({1, 2, 3});
+    Polynom<scalar, 2> second({1, 2, 3.0000000000000004});
+    Polynom<scalar, 3> third({1, 2, 3, 0});
+
+    ASSERT_EQ(PolynomIdentity(first), PolynomIdentity(Polynom<scalar, 2>({1, 2, 3})));
+    ASSERT_NE(PolynomIdentity(first), PolynomIdentity(second));
+    ASSERT_NE(PolynomIdentity(first), PolynomIdentity(third));
+}
+
+TEST(EVALUATION_CACHE, HITS_AND_MISSES) {
+
+    Polynom<scalar, 8> polynom({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+    EvaluationCache<scalar> cache(1024);
+
+    const std::uint64_t identity = PolynomIdentity(polynom);
+
+    for (indexType repeat = 0; repeat < 3; ++repeat) {
+        for (indexType i = 0; i < 100; ++i) {
+            const scalar x = 6.5 + 0.003 * static_cast<scalar>(i);
+            ASSERT_EQ(CompensatedHorner(polynom, x), CachedCompensatedHorner(polynom, identity, x, cache));
+        }
+    }
+
+    ASSERT_EQ(100, cache.Misses());
+    ASSERT_EQ(200, cache.Hits());
+    ASSERT_DOUBLE_EQ(2. / 3., cache.HitRate());
+
+/*
+ * signed zeros have different bit patterns and are different keys
+ */
+
+    scalar value;
+    cache.Insert(identity, 0., 1.);
+    ASSERT_FALSE(cache.Find(identity, -0., value));
+    ASSERT_TRUE(cache.Find(identity, 0., value));
+    ASSERT_EQ(1., value);
+    ASSERT_FALSE(cache.Find(identity + 1, 0., value));
+
+    cache.ResetCounters();
+    ASSERT_EQ(0, cache.Hits());
+    ASSERT_EQ(0, cache.Misses());
+}
+
+TEST(EVALUATION_CACHE, BOUNDED) {
+
+    EvaluationCache<scalar> cache(64, 4);
+    ASSERT_EQ(64, cache.Capacity());
+
+    for (indexType i = 0; i < 10000; ++i) {
+        cache.Insert(1, static_cast<scalar>(i), static_cast<scalar>(2 * i));
+    }
+
+    indexType cached = 0;
+    for (indexType i = 0; i < 10000; ++i) {
+        scalar value;
+        if (cache.Find(1, static_cast<scalar>(i), value)) {
+            ASSERT_EQ(static_cast<scalar>(2 * i), value);
+            ++cached;
+        }
+    }
+
+    ASSERT_LE(cached, cache.Capacity());
+    ASSERT_GT(cached, 0);
+}
+
+TEST(EVALUATION_CACHE, RECENTLY_USED_SURVIVES) {
+
+/*
+ * one shard with one bucket: the referenced entry survives a full round of insertions
+ */
+
+    EvaluationCache<scalar> cache(EvaluationCacheWays, 1);
+    scalar value;
+
+    cache.Insert(1, 0., 10.);
+    for (indexType i = 1; i < EvaluationCacheWays; ++i) {
+        cache.Insert(1, static_cast<scalar>(i), 0.);
+    }
+
+    ASSERT_TRUE(cache.Find(1, 0., value));
+    cache.Insert(1, 100., 0.);
+
+    ASSERT_TRUE(cache.Find(1, 0., value));
+    ASSERT_EQ(10., value);
+    ASSERT_TRUE(cache.Find(1, 100., value));
+}
+
+TEST(EVALUATION_CACHE, CONCURRENT) {
+
+    Polynom<scalar, 5> polynom({1, -0.5, 0.25, 3, -2, 0.125});
+    const std::uint64_t identity = PolynomIdentity(polynom);
+
+    EvaluationCache<scalar> cache(256);
+    std::vector<std::thread> pool;
+    std::atomic<indexType> wrong{0};
+
+    for (indexType t = 0; t < 4; ++t) {
+        pool.emplace_back([&, t]() {
+            for (indexType i = 0; i < 20000; ++i) {
+                const scalar x = static_cast<scalar>((i * 7 + t) % 1000) / 64;
+                if (CachedCompensatedHorner(polynom, identity, x, cache) != CompensatedHorner(polynom, x)) {
+                    ++wrong;
+                }
+            }
+        });
+    }
+
+    for (auto &thread: pool) {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, wrong.load());
+    ASSERT_EQ(80000, cache.Hits() + cache.Misses());
+}
+
+TEST(EVALUATION_CACHE, REFERENCED_BUCKET) {
+
+/*
+ * one full bucket hit by readers while a writer evicts: every slot may be referenced again
+ * between the two rounds of the CLOCK sweep, an entry is evicted anyway
+ */
+
+    EvaluationCache<scalar> cache(EvaluationCacheWays, 1);
+    for (indexType i = 0; i < EvaluationCacheWays; ++i) {
+        cache.Insert(1, static_cast<scalar>(i), static_cast<scalar>(2 * i));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<indexType> wrong{0};
+    std::vector<std::thread> readers;
+
+    for (indexType t = 0; t < 3; ++t) {
+        readers.emplace_back([&]() {
+            while (!done.load(std::memory_order_relaxed)) {
+                for (indexType i = 0; i < EvaluationCacheWays + 1; ++i) {
+                    scalar value;
+                    if (cache.Find(1, static_cast<scalar>(i), value) && value != static_cast<scalar>(2 * i)) {
+                        ++wrong;
+                    }
+                }
+            }
+        });
+    }
+
+    for (indexType i = 0; i < 200000; ++i) {
+        const indexType key = i % (EvaluationCacheWays + 1);
+        cache.Insert(1, static_cast<scalar>(key), static_cast<scalar>(2 * key));
+    }
+
+    done.store(true);
+    for (auto &thread: readers) {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, wrong.load());
+
+    scalar value;
+    ASSERT_TRUE(cache.Find(1, static_cast<scalar>(EvaluationCacheWays), value));
+    ASSERT_EQ(static_cast<scalar>(2 * EvaluationCacheWays), value);
+}
@@ -0,0 +1,82 @@
+#include "../src/ExpansionArithmetic.h"
+#include <gtest/gtest.h>
+
+TEST(EXPANSION_ARITHMETIC, EXACT_HORNER) {
+
+    /*
+     * (x - 1) ^ 10 in points x = 1 + k * 2 ^ -10, the exact values k ^ 10 * 2 ^ -100 are representable for k < 40
+     */
+
+    Polynom<scalar, 10> polynom({1, -10, 45, -120, 210, -252, 210, -120, 45, -10, 1});
+
+    for (indexType k = 1; k < 40; ++k) {
+        const scalar x = 1 + static_cast<scalar>(k) * std::ldexp(1., -10);
+        const scalar reference = std::pow(static_cast<scalar>(k), 10) * std::ldexp(1., -100);
+
+        Expansion<scalar> exact = ExactHorner(polynom, x);
+
+        ASSERT_EQ(reference, ExpansionRound(exact));
+        ASSERT_EQ(1, ExpansionSign(exact));
+    }
+
+    ASSERT_EQ(0, ExpansionSign(ExactHorner(polynom, 1.)));
+}
+
+TEST(EXPANSION_ARITHMETIC, ROUNDING) {
+
+    /*
+     * 1 + 2 ^ -53 * x: x = 1, -1.5 and 3 are ties and round to even, x = 1.5 rounds up
+     */
+
+    Polynom<scalar, 1> polynom({1, std::ldexp(1., -53)});
+
+    ASSERT_EQ(1, ReferenceHorner(polynom, 1.));
+    ASSERT_EQ(1 + std::ldexp(1., -52), ReferenceHorner(polynom, 1.5));
+    ASSERT_EQ(1 - std::ldexp(1., -52), ReferenceHorner(polynom, -1.5));
+    ASSERT_EQ(1 - std::ldexp(1., -53), ReferenceHorner(polynom, -1.));
+    ASSERT_EQ(1 + std::ldexp(1., -51), ReferenceHorner(polynom, 3.));
+}
+
+TEST(EXPANSION_ARITHMETIC, PRODUCT) {
+
+    const Expansion<scalar> e = {std::ldexp(1., -60), 1};
+    const Expansion<scalar> f = {-std::ldexp(1., -70), 3};
+
+    /*
+     * (1 + 2 ^ -60) * (3 - 2 ^ -70) = 3 + 3 * 2 ^ -60 - 2 ^ -70 - 2 ^ -130
+     */
+
+    Expansion<scalar> product = ExpansionProduct(e, f);
+    Expansion<scalar> reference = {-std::ldexp(1., -130), -std::ldexp(1., -70), 3 * std::ldexp(1., -60), 3};
+
+    Expansion<scalar> difference = product;
+    for (const scalar &component: reference) {
+        difference = ExpansionSum(difference, {-component});
+    }
+
+    ASSERT_EQ(0, ExpansionSign(difference));
+}
+
+TEST(EXPANSION_ARITHMETIC, REFERENCE_BATCH) {
+
+    /*
+     * Reference values of (x - 1) ^ 10 agree with the decimal references of TEST_1 up to the rounding of the points
+     */
+
+    Polynom<scalar, 10> polynom({1, -10, 45, -120, 210, -252, 210, -120, 45, -10, 1});
+
+    Containers::array<scalar, 5> test_points = {1.33300, 1.22345, 1.11390, 1.05130, 1.02313};
+    Containers::array<scalar, 5> reference_results = {0.00001676649698063893054717344900000000000000000000,
+                                                      3.1031558659453595151432898820000349619140625E-7,
+                                                      3.6748298954841974896829019906010000000000E-10,
+                                                      1.2623321727659510109666068490000000000E-13,
+                                                      4.382847176545605626845729158120849E-17};
+
+    Containers::array<scalar, 5> out;
+    ReferenceHornerBatch(polynom, test_points.data(), test_points.size(), out.data(), 2);
+
+    for (indexType i = 0; i < test_points.size(); ++i) {
+        ASSERT_EQ(ReferenceHorner(polynom, test_points[i]), out[i]);
+        ASSERT_LT(std::abs(out[i] - reference_results[i]) / reference_results[i], 1e-12);
+    }
+}
@@ -0,0 +1,59 @@
+#include "../src/FaithfulEvaluation.h"
+#include <gtest/gtest.h>
+
+/*
+ * Faithful result is one of the two floating point neighbours of the exact value,
+ * the correctly rounded reference is one of them too
+ */
+
+template<typename T>
+bool IsFaithfulTo(const T &result, const T &reference) {
+    return result == reference ||
+           result == std::nextafter(reference, std::numeric_limits<T>::infinity()) ||
+           result == std::nextafter(reference, -std::numeric_limits<T>::infinity());
+}
+
+TEST(FAITHFUL_EVAL, ILL_CONDITIONED) {
+
+    /*
+     * (x - 1) ^ 10 on the points of TEST_1, condition numbers grow from 2.8e8 to 2.6e19
+     */
+
+    Polynom<scalar, 10> polynom({1, -10, 45, -120, 210, -252, 210, -120, 45, -10, 1});
+    FaithfulHornerCounters counters;
+
+    const indexType size = 100;
+    for (indexType i = 0; i < size; ++i) {
+        const scalar x = 1.333 - 0.00313 * static_cast<scalar>(i);
+        ASSERT_TRUE(IsFaithfulTo(FaithfulHorner(polynom, x, counters), ReferenceHorner(polynom, x)));
+    }
+
+    ASSERT_EQ(size, counters.evaluations);
+    ASSERT_GT(counters.escalations, 0);
+    ASSERT_LT(counters.escalations, size);
+}
+
+TEST(FAITHFUL_EVAL, WELL_CONDITIONED) {
+
+    /*
+     * (x - 7) ^ 8 far from the root never escalates
+     */
+
+    Polynom<scalar, 8> polynom({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+    FaithfulHornerCounters counters;
+
+    Containers::array<scalar, 50> test_points, out;
+    for (indexType i = 0; i < test_points.size(); ++i) {
+        test_points[i] = 10 + 0.37 * static_cast<scalar>(i);
+    }
+
+    FaithfulHornerBatch(polynom, test_points.data(), test_points.size(), out.data(), counters);
+
+    for (indexType i = 0; i < test_points.size(); ++i) {
+        ASSERT_TRUE(IsFaithfulTo(out[i], ReferenceHorner(polynom, test_points[i])));
+    }
+
+    ASSERT_EQ(test_points.size(), counters.evaluations);
+    ASSERT_EQ(0, counters.escalations);
+    ASSERT_EQ(0, counters.EscalationRate());
+}
@@ -0,0 +1,86 @@
+#include "../src/DoubleDouble.h"
+#include "../src/PolynomEvaluation.h"
+#include <gtest/gtest.h>
+
+TEST(FLOAT_TRAITS, CONSTANTS) {
+
+    ASSERT_EQ(std::ldexp(1.f, -24), FloatTraits<float>::unit_roundoff);
+    ASSERT_EQ(std::ldexp(1., -53), FloatTraits<double>::unit_roundoff);
+    ASSERT_EQ(std::ldexp(1.L, -std::numeric_limits<long double>::digits), FloatTraits<long double>::unit_roundoff);
+    ASSERT_EQ(std::ldexp(1., -104), FloatTraits<DoubleDouble<double>>::unit_roundoff);
+
+    ASSERT_EQ(std::numeric_limits<double>::min(), FloatTraits<double>::underflow);
+    ASSERT_EQ(std::ldexp(1., -969), FloatTraits<DoubleDouble<double>>::underflow);
+
+    ASSERT_EQ(UnitRoundoff<float>(), FloatTraits<float>::unit_roundoff);
+    ASSERT_EQ(Gamma<double>(10), 10 * std::ldexp(1., -53) / (1 - 10 * std::ldexp(1., -53)));
+
+    static_assert(Gamma<float>(4) > 4 * UnitRoundoff<float>());
+    static_assert(FloatTraits<DoubleDouble<double>>::digits == 106);
+
+#if defined(__FP_FAST_FMA)
+    ASSERT_TRUE(FloatTraits<double>::has_fma);
+#else
+    ASSERT_FALSE(FloatTraits<double>::has_fma);
+#endif
+
+#ifdef __SIZEOF_FLOAT128__
+    ASSERT_EQ(113, FloatTraits<__float128>::digits);
+    ASSERT_EQ(std::ldexp(1., -113), static_cast<double>(FloatTraits<__float128>::unit_roundoff));
+    ASSERT_EQ(1, FloatTraits<__float128>::underflow * Detail::PowerOfTwo<__float128>(16382));
+    ASSERT_FALSE(FloatTraits<__float128>::has_fma);
+#endif
+}
+
+/*
+ * (x - 7) ^ 8 near the root: bounds must hold in the precision of every type
+ */
+
+TEST(FLOAT_TRAITS, FLOAT_BOUND) {
+
+    Polynom<float, 8> polynom({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+
+    for (indexType i = 0; i < 100; ++i) {
+        const float x = 6.5f + 0.003f * static_cast<float>(i);
+        const double reference = std::pow(static_cast<double>(x) - 7, 8);
+
+        const BoundStruct<float> value = CompensatedHornerWithBound(polynom, x);
+
+        ASSERT_LE(std::abs(value.result - reference), value.bound * (1 + 1e-6));
+        ASSERT_GE(value.bound, UnitRoundoff<float>() * std::abs(value.result));
+    }
+}
+
+#ifdef __SIZEOF_FLOAT128__
+
+TEST(FLOAT_TRAITS, FLOAT128_BOUND) {
+
+    Polynom<__float128, 8> polynom({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+
+/*
+ * x - 7 = -2 ^ -k is exact, so is the reference 2 ^ -8k
+ */
+
+    for (int k = 1; k < 10; ++k) {
+        const __float128 x = 7 - Detail::PowerOfTwo<__float128>(-k);
+        const __float128 reference = Detail::PowerOfTwo<__float128>(-8 * k);
+
+        const BoundStruct<__float128> value = CompensatedHornerWithBound(polynom, x);
+        const __float128 error = value.result > reference ? value.result - reference : reference - value.result;
+
+        ASSERT_LE(static_cast<double>(error), static_cast<double>(value.bound));
+        ASSERT_LE(static_cast<double>(value.bound), 1e-30 * static_cast<double>(reference));
+    }
+
+/*
+ * Dekker's product replaces fma: (1 + 2 ^ -60) ^ 2 = (1 + 2 ^ -59) + 2 ^ -120
+ */
+
+    const __float128 a = 1 + Detail::PowerOfTwo<__float128>(-60);
+    const ReturnStruct<__float128> product = TwoProductFMA(a, a);
+
+    ASSERT_TRUE(product.result == 1 + Detail::PowerOfTwo<__float128>(-59));
+    ASSERT_TRUE(product.error == Detail::PowerOfTwo<__float128>(-120));
+}
+
+#endif
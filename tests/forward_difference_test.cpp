@@ -0,0 +1,87 @@
+#include "../src/ExpansionArithmetic.h"
+#include "../src/ForwardDifference.h"
+#include <gtest/gtest.h>
+
+/*
+ * Sweeps with dyadic step h = 2 ^ -10, so every point x0 + i * h is exact,
+ * errors are measured against the exact values in expansion arithmetic
+ */
+
+template<typename T, indexType N>
+scalar ExactError(const Polynom<T, N> &polynom, const scalar &x, const scalar &value) {
+    Expansion<scalar> difference;
+    GrowExpansion(ExactHorner(polynom, x), -value, difference);
+    return std::abs(ExpansionEstimate(difference));
+}
+
+TEST(FORWARD_DIFFERENCE, WELL_CONDITIONED) {
+
+    Polynom<scalar, 5> polynom({1, -0.5, 0.25, 3, -2, 0.125});
+
+    const scalar x0 = -1, h = std::ldexp(1., -10);
+    const indexType size = 2048;
+    std::vector<scalar> out(size), bound(size);
+
+    const indexType seeds = ForwardDifferenceHorner(polynom, x0, h, size, 1e-13, out.data(), bound.data());
+
+    ASSERT_LT(seeds, size / 20);
+
+    for (indexType i = 0; i < size; ++i) {
+        ASSERT_LE(ExactError(polynom, x0 + static_cast<scalar>(i) * h, out[i]), bound[i]);
+        ASSERT_LE(bound[i], 1e-13 + UnitRoundoff<scalar>() * std::abs(out[i]) * 2);
+    }
+}
+
+TEST(FORWARD_DIFFERENCE, ILL_CONDITIONED) {
+
+/*
+ * (x - 7) ^ 8 around its root
+ */
+
+    Polynom<scalar, 8> polynom({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+
+    const scalar x0 = 6.5, h = std::ldexp(1., -10);
+    const indexType size = 1024;
+    std::vector<scalar> out(size), bound(size);
+
+    ForwardDifferenceHorner(polynom, x0, h, size, 1e-18, out.data(), bound.data());
+
+    for (indexType i = 0; i < size; ++i) {
+        ASSERT_LE(ExactError(polynom, x0 + static_cast<scalar>(i) * h, out[i]), bound[i]);
+    }
+}
+
+TEST(FORWARD_DIFFERENCE, RESEEDING) {
+
+    Polynom<scalar, 3> polynom({0.1, 0.2, 0.3, 0.4});
+
+    const scalar x0 = 0, h = std::ldexp(1., -10);
+    const indexType size = 100;
+    std::vector<scalar> out(size), bound(size);
+
+/*
+ * zero tolerance degenerates to CompensatedHornerWithBound in every point
+ */
+
+    ASSERT_EQ((size + 3) / 4, ForwardDifferenceHorner(polynom, x0, h, size, scalar(0), out.data(), bound.data()));
+
+    for (indexType i = 0; i < size; ++i) {
+        const BoundStruct<scalar> value = CompensatedHornerWithBound(polynom, x0 + static_cast<scalar>(i) * h);
+        ASSERT_EQ(value.result, out[i]);
+        ASSERT_EQ(value.bound, bound[i]);
+    }
+
+    ASSERT_EQ(1, ForwardDifferenceHorner(polynom, x0, h, 3, scalar(0), out.data()));
+    ASSERT_EQ(1, ForwardDifferenceHorner(polynom, x0, h, size, scalar(1), out.data()));
+}
+
+TEST(FORWARD_DIFFERENCE, CONSTANT) {
+
+    Polynom<scalar, 0> polynom({2.5});
+    std::vector<scalar> out(10);
+
+    ASSERT_EQ(1, ForwardDifferenceHorner(polynom, scalar(0), scalar(1), out.size(), scalar(1), out.data()));
+    for (const scalar &value: out) {
+        ASSERT_EQ(2.5, value);
+    }
+}
@@ -0,0 +1,64 @@
+#include "../src/IntervalEvaluation.h"
+#include <gtest/gtest.h>
+
+/*
+ * (x - 1) ^ 10 in points x = 1 + k * 2 ^ -10, the exact values k ^ 10 * 2 ^ -100 are representable for k < 40
+ */
+
+Polynom<scalar, 10> GetTestPolynom() {
+    return Polynom<scalar, 10>({1, -10, 45, -120, 210, -252, 210, -120, 45, -10, 1});
+}
+
+TEST(INTERVAL_EVAL, INTERVAL_HORNER) {
+
+    Polynom<scalar, 10> polynom = GetTestPolynom();
+
+    for (indexType k = 1; k < 40; ++k) {
+        const scalar x = 1 - static_cast<scalar>(k) * std::ldexp(1., -10);
+        const scalar reference = std::pow(static_cast<scalar>(k), 10) * std::ldexp(1., -100);
+
+        Interval<scalar> enclosure = IntervalHorner(polynom, x);
+
+        ASSERT_LE(enclosure.lo, reference);
+        ASSERT_GE(enclosure.hi, reference);
+    }
+}
+
+TEST(INTERVAL_EVAL, COMPENSATED_INTERVAL_HORNER) {
+
+    Polynom<scalar, 10> polynom = GetTestPolynom();
+
+    /*
+     * Condition number stays below 1e21 for k >= 16, where compensated Horner is still accurate
+     */
+
+    for (indexType k = 16; k < 40; ++k) {
+        const scalar x = 1 + static_cast<scalar>(k) * std::ldexp(1., -10);
+        const scalar reference = std::pow(static_cast<scalar>(k), 10) * std::ldexp(1., -100);
+
+        Interval<scalar> enclosure = CompensatedIntervalHorner(polynom, x);
+
+        ASSERT_LE(enclosure.lo, reference);
+        ASSERT_GE(enclosure.hi, reference);
+        ASSERT_LT((enclosure.hi - enclosure.lo) / reference, 1e-8);
+    }
+}
+
+TEST(INTERVAL_EVAL, BATCH) {
+
+    Polynom<scalar, 10> polynom = GetTestPolynom();
+
+    Containers::array<scalar, 39> test_points;
+    for (indexType k = 0; k < test_points.size(); ++k) {
+        test_points[k] = 1 + static_cast<scalar>(k + 1) * std::ldexp(1., -10);
+    }
+
+    Containers::array<Interval<scalar>, 39> enclosures;
+    CompensatedIntervalHornerBatch(polynom, test_points.data(), test_points.size(), enclosures.data());
+
+    for (indexType k = 0; k < test_points.size(); ++k) {
+        Interval<scalar> enclosure = CompensatedIntervalHorner(polynom, test_points[k]);
+        ASSERT_EQ(enclosure.lo, enclosures[k].lo);
+        ASSERT_EQ(enclosure.hi, enclosures[k].hi);
+    }
+}
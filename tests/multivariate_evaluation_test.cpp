@@ -0,0 +1,91 @@
+#include "../src/MultivariateEvaluation.h"
+#include <gtest/gtest.h>
+
+/*
+ * (x - 1) ^ 5 * (y - 2) ^ 3 as a tensor product of the univariate coeffs
+ */
+
+MultiPolynom<scalar, 5, 3> GetTestPolynom() {
+    Containers::array<scalar, 6> x_coeffs = {-1, 5, -10, 10, -5, 1};
+    Containers::array<scalar, 4> y_coeffs = {-8, 12, -6, 1};
+
+    MultiPolynom<scalar, 5, 3> polynom;
+    for (indexType i = 0; i < x_coeffs.size(); ++i) {
+        for (indexType j = 0; j < y_coeffs.size(); ++j) {
+            polynom({i, j}) = x_coeffs[i] * y_coeffs[j];
+        }
+    }
+
+    return polynom;
+}
+
+TEST(MULTIVARIATE_EVAL, BIVARIATE) {
+
+    MultiPolynom<scalar, 5, 3> polynom = GetTestPolynom();
+
+    for (indexType k = 1; k < 50; ++k) {
+        const scalar dx = k * std::ldexp(1., -12);
+        const scalar dy = std::ldexp(1., -6) - k * std::ldexp(1., -14);
+        const scalar reference = dx * dx * dx * dx * dx * dy * dy * dy;
+
+        BoundStruct<scalar> compensated_horner_result = CompensatedHornerWithBound(polynom, {1 + dx, 2 + dy});
+
+        ASSERT_LE(std::abs(compensated_horner_result.result - reference), compensated_horner_result.bound);
+        ASSERT_LT(std::abs(compensated_horner_result.result - reference) / std::abs(reference), 1e-12);
+    }
+}
+
+TEST(MULTIVARIATE_EVAL, GRID) {
+
+    MultiPolynom<scalar, 5, 3> polynom = GetTestPolynom();
+
+    Containers::array<scalar, 7> x_grid;
+    Containers::array<scalar, 5> y_grid;
+    for (indexType i = 0; i < x_grid.size(); ++i) {
+        x_grid[i] = 0.99 + 0.003 * i;
+    }
+    for (indexType j = 0; j < y_grid.size(); ++j) {
+        y_grid[j] = 1.98 + 0.01 * j;
+    }
+
+    Containers::array<scalar, 35> out;
+    CompensatedHornerGrid(polynom, {x_grid.data(), y_grid.data()}, {x_grid.size(), y_grid.size()}, out.data());
+
+    for (indexType i = 0; i < x_grid.size(); ++i) {
+        for (indexType j = 0; j < y_grid.size(); ++j) {
+            ASSERT_EQ(CompensatedHorner(polynom, {x_grid[i], y_grid[j]}), out[i * y_grid.size() + j]);
+        }
+    }
+}
+
+TEST(MULTIVARIATE_EVAL, TRIVARIATE) {
+
+    /*
+     * x * y ^ 2 * z ^ 3 - 2 * x + 3
+     */
+
+    MultiPolynom<scalar, 1, 2, 3> polynom;
+    for (indexType i = 0; i < MultiPolynom<scalar, 1, 2, 3>::Size; ++i) {
+        polynom[i] = 0;
+    }
+    polynom({1, 2, 3}) = 1;
+    polynom({1, 0, 0}) = -2;
+    polynom({0, 0, 0}) = 3;
+
+    Containers::array<scalar, 3> x_grid = {0.5, 2, -1};
+    Containers::array<scalar, 2> y_grid = {1, 3};
+    Containers::array<scalar, 2> z_grid = {-2, 0.25};
+
+    Containers::array<scalar, 12> out;
+    CompensatedHornerGrid(polynom, {x_grid.data(), y_grid.data(), z_grid.data()}, {3, 2, 2}, out.data());
+
+    for (indexType i = 0; i < x_grid.size(); ++i) {
+        for (indexType j = 0; j < y_grid.size(); ++j) {
+            for (indexType k = 0; k < z_grid.size(); ++k) {
+                const scalar x = x_grid[i], y = y_grid[j], z = z_grid[k];
+                ASSERT_EQ(x * y * y * z * z * z - 2 * x + 3, out[(i * 2 + j) * 2 + k]);
+                ASSERT_EQ(x * y * y * z * z * z - 2 * x + 3, Horner(polynom, {x, y, z}));
+            }
+        }
+    }
+}
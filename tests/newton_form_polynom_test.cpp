@@ -0,0 +1,96 @@
+#include "../src/ExpansionArithmetic.h"
+#include "../src/NewtonFormPolynom.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+/*
+ * Interpolant of (x - 1) ^ 7 in the nodes i / 8, near x = 1 the rounded divided differences leave a cluster of roots.
+ * The reference is the nested multiplication of the stored coeffs in expansion arithmetic
+ */
+
+template<typename T, indexType N>
+scalar ExactError(const NewtonFormPolynom<T, N> &polynom, const scalar &x, const scalar &value) {
+
+    Expansion<scalar> sum = {polynom[N]}, difference, buffer;
+
+    for (indexType i = N; i >= 1; i--) {
+        GrowExpansion(Expansion<scalar>{x}, -polynom.Node(i - 1), difference);
+        GrowExpansion(ExpansionProduct(sum, difference), polynom[i - 1], buffer);
+        CompressExpansion(buffer);
+        sum.swap(buffer);
+    }
+
+    GrowExpansion(sum, -value, difference);
+    return std::abs(ExpansionEstimate(difference));
+}
+
+class NewtonFormTest : public ::testing::Test {
+protected:
+    static constexpr indexType N = 7;
+    NewtonFormPolynom<scalar, N> polynom;
+
+    void SetUp() override {
+        Containers::array<scalar, N + 1> x, y;
+        for (indexType i = 0; i < N + 1; ++i) {
+            x[i] = static_cast<scalar>(i) / 8;
+            y[i] = std::pow(x[i] - 1, 7);
+        }
+        polynom = NewtonFormPolynom<scalar, N>::FromSamples(x, y);
+    }
+};
+
+TEST_F(NewtonFormTest, FROM_SAMPLES) {
+
+    for (indexType i = 0; i < N + 1; ++i) {
+        const scalar x = static_cast<scalar>(i) / 8;
+        ASSERT_NEAR(std::pow(x - 1, 7), CompensatedHorner(polynom, x), 1e-15);
+    }
+
+    ASSERT_NEAR(1, polynom[N], 1e-12);
+
+    NewtonFormPolynom<scalar, 0> constant = NewtonFormPolynom<scalar, 0>::FromSamples({2}, {3});
+    ASSERT_EQ(3, CompensatedHorner(constant, 5.));
+    ASSERT_LE(CompensatedHornerWithBound(constant, 5.).bound, 4 * UnitRoundoff<scalar>());
+}
+
+TEST_F(NewtonFormTest, ILL_CONDITIONED) {
+
+    scalar naive_error = 0, compensated_error = 0;
+
+    for (indexType k = 0; k < 200; ++k) {
+        const scalar x = 0.99 + 1e-4 * static_cast<scalar>(k);
+
+        const BoundStruct<scalar> value = CompensatedHornerWithBound(polynom, x);
+        const scalar error = ExactError(polynom, x, value.result);
+
+        ASSERT_EQ(value.result, CompensatedHorner(polynom, x));
+        ASSERT_LE(error, value.bound);
+
+        naive_error = std::max(naive_error, ExactError(polynom, x, Horner(polynom, x)));
+        compensated_error = std::max(compensated_error, error);
+    }
+
+    ASSERT_LT(compensated_error * 1e6, naive_error);
+}
+
+TEST_F(NewtonFormTest, BATCH) {
+
+    std::vector<scalar> x;
+    for (indexType k = 0; k < 1003; ++k) {
+        x.push_back(0.9 + 2.1e-4 * static_cast<scalar>(k));
+    }
+
+    std::vector<scalar> out(x.size()), bounded(x.size()), bound(x.size());
+    CompensatedHornerBatch(polynom, x.data(), x.size(), out.data());
+    CompensatedHornerWithBoundBatch(polynom, x.data(), x.size(), bounded.data(), bound.data());
+
+    for (indexType k = 0; k < x.size(); ++k) {
+        const BoundStruct<scalar> value = CompensatedHornerWithBound(polynom, x[k]);
+
+        ASSERT_EQ(value.result, out[k]);
+        ASSERT_EQ(value.result, bounded[k]);
+        ASSERT_EQ(value.bound, bound[k]);
+        ASSERT_LE(ExactError(polynom, x[k], out[k]), bound[k]);
+    }
+}
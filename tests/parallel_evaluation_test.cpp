@@ -0,0 +1,58 @@
+#include "../src/ParallelEvaluation.h"
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <vector>
+
+/*
+ * (x - 7) ^ 8 on a dense sweep around the root, every policy must reproduce the sequential values bit for bit
+ */
+
+class ParallelEvaluationTest : public ::testing::Test {
+protected:
+    Polynom<scalar, 8> polynom{{5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1}};
+    std::vector<scalar> points;
+
+    void SetUp() override {
+        for (indexType i = 0; i < 100000; ++i) {
+            points.push_back(6.5 + 1e-5 * static_cast<scalar>(i));
+        }
+    }
+};
+
+TEST_F(ParallelEvaluationTest, POLICIES) {
+
+    for (const Kernel kernel: {Kernel::Horner, Kernel::Compensated}) {
+
+        std::vector<scalar> reference(points.size());
+        EvaluateRange(std::execution::seq, polynom, points.begin(), points.end(), reference.begin(), kernel);
+
+        for (indexType i = 0; i < points.size(); i += 997) {
+            ASSERT_EQ(kernel == Kernel::Horner ? Horner(polynom, points[i]) : CompensatedHorner(polynom, points[i]),
+                      reference[i]);
+        }
+
+        std::vector<scalar> par(points.size()), par_unseq(points.size()), unseq(points.size());
+        EvaluateRange(std::execution::par, polynom, points.begin(), points.end(), par.begin(), kernel);
+        EvaluateRange(std::execution::par_unseq, polynom, points.begin(), points.end(), par_unseq.begin(), kernel);
+        EvaluateRange(std::execution::unseq, polynom, points.begin(), points.end(), unseq.begin(), kernel);
+
+        ASSERT_EQ(reference, par);
+        ASSERT_EQ(reference, par_unseq);
+        ASSERT_EQ(reference, unseq);
+    }
+}
+
+TEST_F(ParallelEvaluationTest, ITERATORS) {
+
+    const std::deque<scalar> input(points.begin(), points.end());
+    std::deque<scalar> output(input.size());
+
+    ASSERT_EQ(output.end(), EvaluateRange(std::execution::par, polynom, input.begin(), input.end(),
+                                          output.begin()));
+
+    std::vector<scalar> reference;
+    EvaluateRange(polynom, points.begin(), points.end(), std::back_inserter(reference));
+
+    ASSERT_EQ(reference, std::vector<scalar>(output.begin(), output.end()));
+}
@@ -4,13 +4,12 @@
 /*
  * Theoretical absolute relative error is calculated using this expression:
  * RELATIVE_ERROR ~< (100 * PRECISION) + CONDITION_NUMBER * (100 * PRECISION) ^ 2
- * where u = 2^-53 ~ 1.11e-16 -- unit roundoff for double aka scalar
+ * where u -- unit roundoff from FloatTraits, 2^-53 ~ 1.11e-16 for double aka scalar
  */
 
 template<typename T>
 T CalcGamma(const indexType &n) {
-    T u = 1.11e-16;
-    return n * u / (1 - n * u);
+    return FloatTraits<T>::Gamma(n);
 }
 
 template<typename T, indexType N>
@@ -27,7 +26,7 @@ Polynom<T, N> GetAbs(const Polynom<T, N> &polynom) {
 template<typename T, indexType N>
 T CalcAbsoluteError(const Polynom<T, N> &polynom, const T &x) {
     T res;
-    T u = 1.11e-16;
+    T u = FloatTraits<T>::unit_roundoff;
     Polynom<T, N - 1> polynom_pi, polynom_sigma;
 
     ReturnStruct<T> p, s;
@@ -1725,3 +1724,28 @@ TEST(POLYNOM_EVAL, TEST_7) {
 
 }
 
+
+TEST(POLYNOM_EVAL, ERROR_FREE_PRODUCT) {
+
+/*
+ * Veltkamp's split and Dekker's product stay exact in builds for FMA targets (-march=native)
+ */
+
+    scalar a = 0.7236068, b = 1.3819660;
+
+    for (indexType i = 0; i < 1000; ++i) {
+        a = std::fmod(a * 3.1415926535897931 + 0.1234567, 2.) + 0.5;
+        b = std::fmod(b * 2.7182818284590451 + 0.7654321, 3.) - 1.5;
+
+        const ReturnStruct<scalar> split = Split(a);
+        const scalar scaled = std::ldexp(split.result, 25 - std::ilogb(split.result));
+        ASSERT_EQ(a, split.result + split.error);
+        ASSERT_EQ(std::trunc(scaled), scaled);
+
+        const ReturnStruct<scalar> product = TwoProduct(a, b);
+        const ReturnStruct<scalar> presplit = TwoProduct(a, split, b);
+        ASSERT_EQ(a * b, product.result);
+        ASSERT_EQ(std::fma(a, b, -product.result), product.error);
+        ASSERT_EQ(product.error, presplit.error);
+    }
+}
@@ -0,0 +1,90 @@
+#include "../src/PolynomMultiplication.h"
+#include <gtest/gtest.h>
+
+template<typename T, indexType N, indexType M>
+Polynom<T, N + M> NaiveMultiply(const Polynom<T, N> &lhs, const Polynom<T, M> &rhs) {
+    Polynom<T, N + M> result;
+
+    for (indexType i = 0; i < N + M + 1; ++i) {
+        result[i] = 0;
+    }
+
+    for (indexType i = 0; i < N + 1; ++i) {
+        for (indexType j = 0; j < M + 1; ++j) {
+            result[i + j] += lhs[i] * rhs[j];
+        }
+    }
+
+    return result;
+}
+
+template<typename T, indexType N>
+Polynom<T, N> GetTestPolynom(const indexType &seed) {
+    Polynom<T, N> result;
+
+    for (indexType i = 0; i < N + 1; ++i) {
+        result[i] = static_cast<T>(static_cast<long long>((i * 7919 + seed * 104729) % 17) - 8);
+    }
+
+    return result;
+}
+
+TEST(POLYNOM_MULTIPLY, SCHOOLBOOK) {
+
+    /*
+     * (x - 1) ^ 10
+     */
+
+    Containers::array<scalar, 11> reference_coeffs = {1, -10, 45, -120, 210, -252, 210, -120, 45, -10, 1};
+    Polynom<scalar, 1> factor({-1, 1});
+
+    Polynom<scalar, 10> polynom = factor * factor * factor * factor * factor * factor * factor * factor * factor * factor;
+
+    for (indexType i = 0; i < reference_coeffs.size(); ++i) {
+        ASSERT_EQ(reference_coeffs[i], polynom[i]);
+    }
+}
+
+TEST(POLYNOM_MULTIPLY, KARATSUBA) {
+
+    Polynom<scalar, 150> lhs = GetTestPolynom<scalar, 150>(1);
+    Polynom<scalar, 97> rhs = GetTestPolynom<scalar, 97>(2);
+
+    Polynom<scalar, 247> result = Multiply(lhs, rhs);
+    Polynom<scalar, 247> reference = NaiveMultiply(lhs, rhs);
+
+    for (indexType i = 0; i < 248; ++i) {
+        ASSERT_EQ(reference[i], result[i]);
+    }
+}
+
+TEST(POLYNOM_MULTIPLY, FFT) {
+
+    Polynom<scalar, 700> lhs = GetTestPolynom<scalar, 700>(3);
+    Polynom<scalar, 600> rhs = GetTestPolynom<scalar, 600>(4);
+
+    Polynom<scalar, 1300> result = Multiply(lhs, rhs);
+    Polynom<scalar, 1300> reference = NaiveMultiply(lhs, rhs);
+
+    for (indexType i = 0; i < 1301; ++i) {
+        ASSERT_NEAR(reference[i], result[i], 1e-8);
+    }
+}
+
+TEST(POLYNOM_MULTIPLY, COMPENSATED) {
+
+    /*
+     * (1 + eps * x) * (1 - eps * x) = 1 - eps ^ 2 * x ^ 2, the product coefficient of x is exactly zero
+     */
+
+    const scalar eps = std::ldexp(1., -30) / 3;
+    Polynom<scalar, 1> lhs({1, eps});
+    Polynom<scalar, 1> rhs({1, -eps});
+
+    ReturnStruct<Polynom<scalar, 2>> product = MultiplyCompensated(lhs, rhs);
+
+    ASSERT_EQ(1, product.result[0] + product.error[0]);
+    ASSERT_EQ(0, product.result[1] + product.error[1]);
+    ASSERT_EQ(-eps * eps, product.result[2]);
+    ASSERT_EQ(std::fma(-eps, eps, eps * eps), product.error[2]);
+}
@@ -0,0 +1,98 @@
+#include "../src/ExpansionArithmetic.h"
+#include "../src/PowerTable.h"
+#include <gtest/gtest.h>
+
+/*
+ * Grid of TEST_5: 6.5, 6.503, ..., 6.797, references are correctly rounded values from expansion arithmetic
+ */
+
+class PowerTableTest : public ::testing::Test {
+protected:
+    std::vector<scalar> grid;
+
+    void SetUp() override {
+        for (indexType i = 0; i < 100; ++i) {
+            grid.push_back(6.5 + 0.003 * static_cast<scalar>(i));
+        }
+    }
+};
+
+TEST_F(PowerTableTest, POWERS) {
+
+    const PowerTable<scalar, 8> table(grid.data(), grid.size());
+    ASSERT_EQ(grid.size(), table.Size());
+
+    for (indexType j = 0; j < grid.size(); ++j) {
+        Expansion<scalar> exact = {1}, buffer;
+
+        for (indexType k = 0; k <= 8; ++k) {
+            const DoubleDouble<scalar> power = table.Power(k, j);
+            const scalar reference = ExpansionRound(exact);
+
+            ASSERT_EQ(reference, power.hi + power.lo);
+
+            Expansion<scalar> difference;
+            GrowExpansion(exact, -power.hi, buffer);
+            GrowExpansion(buffer, -power.lo, difference);
+            ASSERT_LE(std::abs(ExpansionEstimate(difference)),
+                      2 * (k + 1) * UnitRoundoff<scalar>() * UnitRoundoff<scalar>() * std::abs(reference));
+
+            ScaleExpansion(exact, grid[j], buffer);
+            exact.swap(buffer);
+        }
+    }
+}
+
+TEST_F(PowerTableTest, ILL_CONDITIONED) {
+
+/*
+ * (x - 7) ^ 8
+ */
+
+    Polynom<scalar, 8> polynom({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+    const PowerTable<scalar, 8> table(grid.data(), grid.size());
+
+    std::vector<scalar> out(grid.size()), bound(grid.size());
+    table.EvaluateWithBound(polynom, out.data(), bound.data());
+
+    std::vector<scalar> values(grid.size());
+    table.Evaluate(polynom, values.data());
+
+    for (indexType j = 0; j < grid.size(); ++j) {
+        const scalar reference = ReferenceHorner(polynom, grid[j]);
+
+        ASSERT_EQ(values[j], out[j]);
+        ASSERT_LE(std::abs(out[j] - reference), bound[j]);
+        ASSERT_LE(std::abs(out[j] - reference), 1e-12 * std::abs(reference));
+    }
+}
+
+TEST_F(PowerTableTest, SHARED_TABLE) {
+
+/*
+ * polynoms of different degrees evaluated on one table
+ */
+
+    const PowerTable<scalar, 8> table(grid.data(), grid.size());
+
+    Polynom<scalar, 2> quadratic({-3, 0.5, 0.25});
+    Polynom<scalar, 5> quintic({1, -5, 10, -10, 5, -1});
+    Polynom<scalar, 0> constant({42});
+
+    std::vector<scalar> out(grid.size()), bound(grid.size());
+
+    table.EvaluateWithBound(quadratic, out.data(), bound.data());
+    for (indexType j = 0; j < grid.size(); ++j) {
+        ASSERT_LE(std::abs(out[j] - ReferenceHorner(quadratic, grid[j])), bound[j]);
+    }
+
+    table.EvaluateWithBound(quintic, out.data(), bound.data());
+    for (indexType j = 0; j < grid.size(); ++j) {
+        ASSERT_LE(std::abs(out[j] - ReferenceHorner(quintic, grid[j])), bound[j]);
+    }
+
+    table.Evaluate(constant, out.data());
+    for (indexType j = 0; j < grid.size(); ++j) {
+        ASSERT_EQ(42, out[j]);
+    }
+}
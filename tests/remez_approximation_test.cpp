@@ -0,0 +1,87 @@
+#include "../src/RemezApproximation.h"
+#include <gtest/gtest.h>
+
+/*
+ * Minimax errors of exp on [-1, 1]: E_3 = 5.5283701e-3, E_4 = 5.4666760e-4
+ */
+
+TEST(REMEZ, EXP) {
+
+    const auto function = [](const scalar &x) { return std::exp(x); };
+
+    const RemezStruct<scalar, 3> cubic = Remez<3>(function, -1., 1.);
+    ASSERT_TRUE(cubic.converged);
+    ASSERT_NEAR(5.5283701e-3, cubic.max_error, 1e-9);
+
+    const RemezStruct<scalar, 4> quartic = Remez<4>(function, -1., 1.);
+    ASSERT_TRUE(quartic.converged);
+    ASSERT_NEAR(5.4666760e-4, quartic.max_error, 1e-10);
+
+    for (indexType i = 0; i < 1000; ++i) {
+        const scalar x = -1 + 0.002 * static_cast<scalar>(i);
+        ASSERT_LE(std::abs(function(x) - Horner(quartic.polynom, x)), quartic.max_error * (1 + 1e-6));
+    }
+}
+
+TEST(REMEZ, SHIFTED_INTERVAL) {
+
+/*
+ * sin on [1, 2] in degree 8, the Taylor polynom in 1.5 of the same degree is about 30 times worse
+ */
+
+    const auto function = [](const scalar &x) { return std::sin(x); };
+    const RemezStruct<scalar, 8> approximation = Remez<8>(function, 1., 2.);
+
+    ASSERT_TRUE(approximation.converged);
+    ASSERT_GT(approximation.iterations, 0);
+    ASSERT_LT(approximation.max_error, std::pow(0.5, 9) / 362880 / 30);
+
+    scalar max_error = 0;
+    for (indexType i = 0; i < 4096; ++i) {
+        const scalar x = 1 + static_cast<scalar>(i) / 4095;
+        max_error = std::max(max_error, std::abs(function(x) - CompensatedHorner(approximation.polynom, x)));
+    }
+
+    ASSERT_LE(max_error, approximation.max_error * (1 + 1e-6));
+    ASSERT_GE(max_error, approximation.max_error * (1 - 1e-3));
+}
+
+TEST(REMEZ, TARGET_ERROR) {
+
+/*
+ * E_3 = 5.5e-3 < 1e-2 < E_2 for exp on [-1, 1]: degree 3 is the first to meet the target
+ */
+
+    const auto function = [](const scalar &x) { return std::exp(x); };
+
+    const RemezTargetStruct<scalar, 6> cubic = RemezToTarget<6>(function, -1., 1., 1e-2);
+    ASSERT_TRUE(cubic.found);
+    ASSERT_EQ(3, cubic.degree);
+    ASSERT_NEAR(5.5283701e-3, cubic.approximation.max_error, 1e-9);
+
+    const RemezStruct<scalar, 3> reference = Remez<3>(function, -1., 1.);
+    for (indexType i = 0; i < 4; ++i) {
+        ASSERT_EQ(reference.polynom[i], cubic.approximation.polynom[i]);
+    }
+    ASSERT_EQ(0, cubic.approximation.polynom[4]);
+    ASSERT_EQ(0, cubic.approximation.polynom[6]);
+
+    const RemezTargetStruct<scalar, 4> missed = RemezToTarget<4>(function, -1., 1., 1e-6);
+    ASSERT_FALSE(missed.found);
+    ASSERT_EQ(4, missed.degree);
+    ASSERT_GT(missed.approximation.max_error, 1e-6);
+}
+
+TEST(REMEZ, EXACT_POLYNOM) {
+
+    const RemezStruct<scalar, 3> approximation = Remez<3>([](const scalar &x) { return x * x - 1; }, 1., 3.);
+
+    ASSERT_TRUE(approximation.converged);
+    ASSERT_LT(approximation.max_error, 1e-14);
+    ASSERT_NEAR(-1, approximation.polynom[0], 1e-13);
+    ASSERT_NEAR(0, approximation.polynom[1], 1e-13);
+    ASSERT_NEAR(1, approximation.polynom[2], 1e-13);
+    ASSERT_NEAR(0, approximation.polynom[3], 1e-13);
+
+    ASSERT_THROW(Remez<3>([](const scalar &x) { return x; }, 1., 1.), std::invalid_argument);
+}
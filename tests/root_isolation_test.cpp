@@ -0,0 +1,120 @@
+#include "../src/RootIsolation.h"
+#include <gtest/gtest.h>
+
+template<typename T, indexType N>
+int ExactSign(const Polynom<T, N> &polynom, const T &x) {
+    return ExpansionSign(ExactHorner(polynom, x));
+}
+
+TEST(ROOT_ISOLATION, MULTIPLE_ROOT) {
+
+/*
+ * (x - 1) ^ 10
+ */
+
+    Polynom<scalar, 10> polynom({1, -10, 45, -120, 210, -252, 210, -120, 45, -10, 1});
+    const RootIsolationStruct<scalar> result = IsolateRealRoots(polynom);
+
+    ASSERT_EQ(1, result.intervals.size());
+    ASSERT_EQ(1, result.intervals[0].lo);
+    ASSERT_EQ(1, result.intervals[0].hi);
+    ASSERT_EQ(10, result.intervals[0].count);
+    ASSERT_TRUE(result.intervals[0].isolated);
+}
+
+TEST(ROOT_ISOLATION, TWO_MULTIPLE_ROOTS) {
+
+/*
+ * (x - 1) ^ 5 * (x - 5) ^ 5 and (x - 7) ^ 8
+ */
+
+    Polynom<scalar, 10> first({3125, -18750, 48125, -69000, 60650, -33876, 12130, -2760, 385, -30, 1});
+    const RootIsolationStruct<scalar> result = IsolateRealRoots(first);
+
+    ASSERT_EQ(2, result.intervals.size());
+    ASSERT_EQ(1, result.intervals[0].lo);
+    ASSERT_EQ(5, result.intervals[0].count);
+    ASSERT_EQ(5, result.intervals[1].lo);
+    ASSERT_EQ(5, result.intervals[1].hi);
+    ASSERT_EQ(5, result.intervals[1].count);
+
+    Polynom<scalar, 8> second({5764801, -6588344, 3294172, -941192, 168070, -19208, 1372, -56, 1});
+    const RootIsolationStruct<scalar> other = IsolateRealRoots(second);
+
+    ASSERT_EQ(1, other.intervals.size());
+    ASSERT_EQ(7, other.intervals[0].lo);
+    ASSERT_EQ(8, other.intervals[0].count);
+}
+
+TEST(ROOT_ISOLATION, NEAR_MULTIPLE_ROOT) {
+
+/*
+ * (x - 1) ^ 10 - 3 * 2 ^ -40: two simple real roots 1 +- (3 * 2 ^ -40) ^ (1 / 10) close to the tenfold root
+ */
+
+    Polynom<scalar, 10> polynom({1 - 3 * std::ldexp(1., -40), -10, 45, -120, 210, -252, 210, -120, 45, -10, 1});
+    const RootIsolationStruct<scalar> result = IsolateRealRoots(polynom);
+
+    const scalar distance = std::pow(3 * std::ldexp(1., -40), 0.1);
+    const scalar roots[2] = {1 - distance, 1 + distance};
+
+    ASSERT_EQ(2, result.intervals.size());
+    for (indexType i = 0; i < 2; ++i) {
+        const RootInterval<scalar> &interval = result.intervals[i];
+
+        ASSERT_TRUE(interval.isolated);
+        ASSERT_EQ(1, interval.count);
+        ASSERT_LT(interval.lo, roots[i]);
+        ASSERT_GT(interval.hi, roots[i]);
+        ASSERT_EQ(-ExactSign(polynom, interval.lo), ExactSign(polynom, interval.hi));
+    }
+
+/*
+ * most signs are certified in floating point arithmetic
+ */
+
+    ASSERT_LT(result.exact_nodes + result.exact_signs, result.nodes);
+}
+
+TEST(ROOT_ISOLATION, SIMPLE_ROOTS) {
+
+/*
+ * (x - 0.1) * (x - 0.2) * (x - 0.3) with rounded coeffs
+ */
+
+    Polynom<scalar, 3> polynom({-0.006, 0.11, -0.6, 1});
+    const RootIsolationStruct<scalar> result = IsolateRealRoots(polynom);
+
+    ASSERT_EQ(3, result.intervals.size());
+    for (indexType i = 0; i < 3; ++i) {
+        const scalar root = 0.1 * static_cast<scalar>(i + 1);
+        ASSERT_EQ(1, result.intervals[i].count);
+        ASSERT_LT(result.intervals[i].lo, root + 1e-12);
+        ASSERT_GT(result.intervals[i].hi, root - 1e-12);
+    }
+    ASSERT_EQ(0, result.exact_nodes);
+}
+
+TEST(ROOT_ISOLATION, CLUSTER) {
+
+/*
+ * (x - 0.1) ^ 3 with rounded coeffs: the triple root splits at the scale u ^ (1 / 3)
+ */
+
+    Polynom<scalar, 3> polynom({-0.001, 0.03, -0.3, 1});
+    const RootIsolationStruct<scalar> result = IsolateRealRoots(polynom, 1e-12);
+
+    indexType count = 0;
+    for (const RootInterval<scalar> &interval: result.intervals) {
+        ASSERT_GT(interval.lo, 0.1 - 1e-3);
+        ASSERT_LT(interval.hi, 0.1 + 1e-3);
+        count += interval.count;
+    }
+    ASSERT_EQ(1, count % 2);
+}
+
+TEST(ROOT_ISOLATION, INVALID) {
+
+    Polynom<scalar, 2> polynom({1, 1, 0});
+    ASSERT_THROW(IsolateRealRoots(polynom), std::invalid_argument);
+}
@@ -0,0 +1,76 @@
+#include "../src/ExpansionArithmetic.h"
+#include "../src/SparsePolynom.h"
+#include <gtest/gtest.h>
+
+TEST(SPARSE_POLYNOM, CONSTRUCTION) {
+
+    SparsePolynom<scalar> polynom({100000, 3, 0, 77777}, {1, 0.5, 7, 0});
+
+    ASSERT_EQ(3, polynom.Size());
+    ASSERT_EQ(100000, polynom.Degree());
+    ASSERT_EQ(0, polynom.Exponent(0));
+    ASSERT_EQ(3, polynom.Exponent(1));
+    ASSERT_EQ(0.5, polynom[1]);
+
+    Polynom<scalar, 5> dense({0, 1, 0, 0, -2, 0});
+    SparsePolynom<scalar> sparse(dense);
+    ASSERT_EQ(2, sparse.Size());
+    ASSERT_EQ(4, sparse.Degree());
+
+    ASSERT_THROW(SparsePolynom<scalar>({1, 2}, {1}), std::invalid_argument);
+    ASSERT_THROW(SparsePolynom<scalar>({1, 1}, {1, 2}), std::invalid_argument);
+}
+
+TEST(SPARSE_POLYNOM, DENSE_EQUIVALENT) {
+
+/*
+ * x ^ 300 - 3 * x ^ 211 + 0.1 * x ^ 17 - x + 0.3 against the exact value of the dense polynom
+ */
+
+    Polynom<scalar, 300> dense;
+    for (indexType i = 0; i < 301; ++i) {
+        dense[i] = 0;
+    }
+    dense[300] = 1;
+    dense[211] = -3;
+    dense[17] = 0.1;
+    dense[1] = -1;
+    dense[0] = 0.3;
+
+    const SparsePolynom<scalar> sparse(dense);
+
+    for (indexType i = 0; i < 50; ++i) {
+        const scalar x = 0.9 + 0.004 * static_cast<scalar>(i);
+        const BoundStruct<scalar> value = CompensatedHornerWithBound(sparse, x);
+
+        Expansion<scalar> difference;
+        GrowExpansion(ExactHorner(dense, x), -value.result, difference);
+
+        ASSERT_LE(std::abs(ExpansionEstimate(difference)), value.bound);
+        ASSERT_EQ(value.result, CompensatedHorner(sparse, x));
+    }
+}
+
+TEST(SPARSE_POLYNOM, HIGH_DEGREE) {
+
+/*
+ * (x ^ 50000 - 1) ^ 2 in x = 1 + 2 ^ -30, condition number about 2e9
+ */
+
+    SparsePolynom<scalar> polynom({0, 50000, 100000}, {1, -2, 1});
+    const scalar x = 1 + std::ldexp(1., -30);
+    const scalar reference = 2.1685053198901270684712090220967165947825942336273933746382557732366252381156862E-9;
+
+    const BoundStruct<scalar> value = CompensatedHornerWithBound(polynom, x);
+
+    ASSERT_LE(std::abs(value.result - reference), value.bound + UnitRoundoff<scalar>() * reference);
+    ASSERT_LE(std::abs(value.result - reference), 1e-15 * reference);
+    ASSERT_LE(value.bound, 1e-14 * reference);
+}
+
+TEST(SPARSE_POLYNOM, EMPTY) {
+
+    SparsePolynom<scalar> polynom;
+    ASSERT_EQ(0, CompensatedHorner(polynom, 2.));
+    ASSERT_EQ(0, CompensatedHornerWithBound(polynom, 2.).bound);
+}
@@ -0,0 +1,82 @@
+#include "../src/StaticPolynom.h"
+#include <gtest/gtest.h>
+
+/*
+ * Static kernels against Horner and CompensatedHorner of the same Polynom: bit for bit where the type has no fast
+ * fma, so nothing is contracted. Otherwise the unrolled and the loop kernels are contracted differently and agree
+ * within the error bounds: gamma_2N * Horner(|a|, |x|) and the bound of CompensatedHornerWithBound
+ */
+
+template<typename P>
+void ExpectSameAsPolynom(const P &polynom, const typename P::value_type &begin, const typename P::value_type &step) {
+
+    using T = typename P::value_type;
+    const Polynom<T, P::degree> dynamic = polynom;
+
+    for (indexType i = 0; i < 1000; ++i) {
+        const T x = begin + step * static_cast<T>(i);
+
+        if constexpr (FloatTraits<T>::has_fma) {
+            T condition = 0;
+            for (indexType k = P::degree + 1; k >= 1; k--) {
+                condition = condition * std::abs(x) + std::abs(dynamic[k - 1]);
+            }
+            const BoundStruct<T> reference = CompensatedHornerWithBound(dynamic, x);
+
+            ASSERT_NEAR(Horner(dynamic, x), Horner(polynom, x), 2 * Gamma<T>(2 * P::degree) * condition);
+            ASSERT_NEAR(reference.result, CompensatedHorner(polynom, x), 2 * reference.bound);
+        } else {
+            ASSERT_EQ(Horner(dynamic, x), Horner(polynom, x));
+            ASSERT_EQ(CompensatedHorner(dynamic, x), CompensatedHorner(polynom, x));
+        }
+    }
+}
+
+TEST(STATIC_POLYNOM, CONSTRUCTION) {
+
+    constexpr StaticPolynom<0.5, 0., -3., 1.> polynom;
+
+    static_assert(polynom.degree == 3);
+    static_assert(polynom[2] == -3);
+    static_assert(polynom.splits[0].result + polynom.splits[0].error == 0.5);
+
+    ASSERT_EQ(0.5, Horner(StaticPolynom<0.5>(), 3.));
+    ASSERT_EQ(0.5, CompensatedHorner(StaticPolynom<0.5>(), 3.));
+}
+
+TEST(STATIC_POLYNOM, FOLDED_COEFFS) {
+
+    ExpectSameAsPolynom(StaticPolynom<0.5, 0., -3., 1.>(), -2., 0.0041);
+    ExpectSameAsPolynom(StaticPolynom<0., 1., 0., 0., -1.>(), -2., 0.0041);
+    ExpectSameAsPolynom(StaticPolynom<0.1, -0.2, 0.3, 0.7, 2.5>(), -2., 0.0041);
+    ExpectSameAsPolynom(StaticPolynom<-1., 1.>(), -2., 0.0041);
+    ExpectSameAsPolynom(StaticPolynom<0.1f, 0.f, 1.f>(), -2.f, 0.0041f);
+}
+
+TEST(STATIC_POLYNOM, ILL_CONDITIONED) {
+
+/*
+ * (x - 7) ^ 8 near its root, the static kernel keeps the accuracy of CompensatedHorner
+ */
+
+    const StaticPolynom<5764801., -6588344., 3294172., -941192., 168070., -19208., 1372., -56., 1.> polynom;
+
+    ExpectSameAsPolynom(polynom, 6.99, 2e-5);
+    ASSERT_NEAR(std::ldexp(1., -32), CompensatedHorner(polynom, 7.0625), 1e-12 * std::ldexp(1., -32));
+}
+
+#ifdef __SIZEOF_FLOAT128__
+
+TEST(STATIC_POLYNOM, WITHOUT_FMA) {
+
+/*
+ * __float128 has no fma in FloatTraits, the products use the precomputed splits
+ */
+
+    using quad = __float128;
+    const StaticPolynom<quad(0.1), quad(-0.2), quad(0), quad(0.7), quad(2.5)> polynom;
+
+    ExpectSameAsPolynom(polynom, quad(-2), quad(0.0041));
+}
+
+#endif
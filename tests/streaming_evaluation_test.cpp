@@ -0,0 +1,95 @@
+#include "../src/StreamingEvaluation.h"
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+/*
+ * (x - 1) ^ 5 * (x - 5) ^ 5 on a point file spanning several chunks
+ */
+
+std::filesystem::path UniqueTempPath(const std::string &prefix) {
+    std::string path = (std::filesystem::temp_directory_path() / (prefix + "XXXXXX")).string();
+    const int descriptor = ::mkstemp(path.data());
+    if (descriptor >= 0) {
+        ::close(descriptor);
+    }
+    return path;
+}
+
+class StreamingEvaluationTest : public ::testing::Test {
+protected:
+    const Polynom<scalar, 10> polynom{{3125, -18750, 48125, -69000, 60650, -33876, 12130, -2760, 385, -30, 1}};
+    const indexType size = 3 * StreamingChunkPoints + 123;
+
+    std::filesystem::path input_path = UniqueTempPath("polynom_streaming_input_");
+    std::filesystem::path output_path = UniqueTempPath("polynom_streaming_output_");
+    std::vector<scalar> test_points;
+
+    void SetUp() override {
+        test_points.resize(size);
+        for (indexType i = 0; i < size; ++i) {
+            test_points[i] = 0.97 + 0.03 * static_cast<scalar>(i) / static_cast<scalar>(size);
+        }
+
+        std::ofstream input(input_path, std::ios::binary);
+        input.write(reinterpret_cast<const char *>(test_points.data()),
+                    static_cast<std::streamsize>(size * sizeof(scalar)));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(input_path);
+        std::filesystem::remove(output_path);
+    }
+
+    void CheckOutput() const {
+        std::vector<scalar> results(size);
+        std::ifstream output(output_path, std::ios::binary);
+        output.read(reinterpret_cast<char *>(results.data()), static_cast<std::streamsize>(size * sizeof(scalar)));
+
+        std::vector<scalar> reference_results(size);
+        CompensatedHornerBatch(polynom, test_points.data(), size, reference_results.data());
+
+        ASSERT_EQ(size * sizeof(scalar), std::filesystem::file_size(output_path));
+        for (indexType i = 0; i < size; ++i) {
+            ASSERT_EQ(reference_results[i], results[i]);
+        }
+    }
+};
+
+TEST_F(StreamingEvaluationTest, SINGLE_THREAD) {
+    ASSERT_EQ(size, StreamingCompensatedHorner(polynom, input_path.string(), output_path.string()));
+    CheckOutput();
+}
+
+TEST_F(StreamingEvaluationTest, MULTIPLE_THREADS) {
+    ASSERT_EQ(size, StreamingCompensatedHorner(polynom, input_path.string(), output_path.string(), 3));
+    CheckOutput();
+}
+
+TEST_F(StreamingEvaluationTest, MISSING_INPUT) {
+    ASSERT_THROW(StreamingCompensatedHorner(polynom, (input_path.string() + ".missing"), output_path.string()),
+                 std::system_error);
+}
+
+TEST_F(StreamingEvaluationTest, FAILED_MAPPING_CLOSES_FILE) {
+
+/*
+ * a directory opens read-only but cannot be mapped, the descriptor must not leak from the constructor
+ */
+
+    const auto count = []() {
+        return std::distance(std::filesystem::directory_iterator("/proc/self/fd"),
+                             std::filesystem::directory_iterator{});
+    };
+
+    const auto before = count();
+    for (indexType i = 0; i < 16; ++i) {
+        ASSERT_THROW(MappedFile(std::filesystem::temp_directory_path().string()), std::system_error);
+    }
+
+    ASSERT_EQ(before, count());
+}
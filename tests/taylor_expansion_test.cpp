@@ -0,0 +1,130 @@
+#include "../src/Deflation.h"
+#include "../src/ExpansionArithmetic.h"
+#include "../src/TaylorExpansion.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+/*
+ * (x - 0.75) ^ 9 * (x - 1) with exact coeffs (multiples of 2 ^ -20), near x = 0.75 all Taylor coeffs up to the
+ * ninth cancel. The reference is repeated synthetic division in expansion arithmetic
+ */
+
+constexpr indexType N = 10, K = 6;
+
+class TaylorExpansionTest : public ::testing::Test {
+protected:
+    Polynom<scalar, N> polynom;
+
+    void SetUp() override {
+        for (indexType i = 0; i < N + 1; ++i) {
+            polynom[i] = i == 0 ? 1 : 0;
+        }
+        for (indexType k = 0; k < N; ++k) {
+            const scalar root = k == 0 ? 1 : 0.75;
+            for (indexType i = N; i >= 1; i--) {
+                polynom[i] = polynom[i - 1] - root * polynom[i];
+            }
+            polynom[0] = -root * polynom[0];
+        }
+    }
+
+    std::vector<scalar> ExactTaylor(const scalar &x) const {
+
+        std::vector<Expansion<scalar>> sum;
+        for (indexType i = 0; i < N + 1; ++i) {
+            sum.push_back({polynom[i]});
+        }
+
+        std::vector<scalar> out;
+        for (indexType j = 0; j < K + 1; ++j) {
+            for (indexType i = N; i > j; i--) {
+                Expansion<scalar> scaled;
+                ScaleExpansion(sum[i], x, scaled);
+                sum[i - 1] = ExpansionSum(scaled, sum[i - 1]);
+                CompressExpansion(sum[i - 1]);
+            }
+            out.push_back(ExpansionRound(sum[j]));
+        }
+
+        return out;
+    }
+};
+
+TEST_F(TaylorExpansionTest, WELL_CONDITIONED) {
+
+/*
+ * p(x) = 1 + x + x ^ 2 + x ^ 3 in x = 2: t = (15, 17, 7, 1)
+ */
+
+    const Polynom<scalar, 3> cubic({1, 1, 1, 1});
+
+    const Containers::array<scalar, 4> expected = {15, 17, 7, 1};
+    ASSERT_EQ(expected, TaylorExpansion<3>(cubic, 2.));
+    ASSERT_EQ(expected, CompensatedTaylorExpansion<3>(cubic, 2.));
+    ASSERT_EQ(expected, CompensatedTaylorExpansionWithBound<3>(cubic, 2.).coeffs);
+}
+
+TEST_F(TaylorExpansionTest, ILL_CONDITIONED) {
+
+    scalar naive_error = 0, compensated_error = 0;
+
+    for (indexType k = 0; k < 100; ++k) {
+        const scalar x = 0.74 + 2.1e-4 * static_cast<scalar>(k);
+
+        const TaylorStruct<scalar, K> taylor = CompensatedTaylorExpansionWithBound<K>(polynom, x);
+        const Containers::array<scalar, K + 1> naive = TaylorExpansion<K>(polynom, x);
+        const std::vector<scalar> reference = ExactTaylor(x);
+
+        ASSERT_NEAR(reference[0], taylor.coeffs[0], CompensatedHornerWithBound(polynom, x).bound);
+        ASSERT_EQ(taylor.coeffs, CompensatedTaylorExpansion<K>(polynom, x));
+
+        for (indexType j = 0; j < K + 1; ++j) {
+            ASSERT_LE(std::abs(taylor.coeffs[j] - reference[j]),
+                      taylor.bound[j] + UnitRoundoff<scalar>() * std::abs(reference[j]));
+
+            naive_error = std::max(naive_error, std::abs(naive[j] - reference[j]));
+            compensated_error = std::max(compensated_error, std::abs(taylor.coeffs[j] - reference[j]));
+        }
+    }
+
+    ASSERT_LT(compensated_error * 1e6, naive_error);
+}
+
+TEST_F(TaylorExpansionTest, CHAINED_DEFLATION) {
+
+    const scalar x = 0.7512;
+    const Containers::array<scalar, 4> taylor = CompensatedTaylorExpansion<3>(polynom, x);
+
+    const DeflationStruct<scalar, N - 1> first = Deflate(polynom, x);
+    const DeflationStruct<scalar, N - 2> second = Deflate(first.quotient, first.correction, x);
+    const DeflationStruct<scalar, N - 3> third = Deflate(second.quotient, second.correction, x);
+    const DeflationStruct<scalar, N - 4> fourth = Deflate(third.quotient, third.correction, x);
+
+    ASSERT_EQ(first.remainder, taylor[0]);
+    ASSERT_EQ(second.remainder, taylor[1]);
+    ASSERT_EQ(third.remainder, taylor[2]);
+    ASSERT_EQ(fourth.remainder, taylor[3]);
+}
+
+TEST_F(TaylorExpansionTest, BATCH) {
+
+    std::vector<scalar> x;
+    for (indexType k = 0; k < 103; ++k) {
+        x.push_back(0.7 + 1e-3 * static_cast<scalar>(k));
+    }
+
+    std::vector<Containers::array<scalar, K + 1>> out(x.size());
+    std::vector<TaylorStruct<scalar, K>> bounded(x.size());
+
+    CompensatedTaylorExpansionBatch<K>(polynom, x.data(), x.size(), out.data());
+    CompensatedTaylorExpansionWithBoundBatch<K>(polynom, x.data(), x.size(), bounded.data());
+
+    for (indexType k = 0; k < x.size(); ++k) {
+        const TaylorStruct<scalar, K> taylor = CompensatedTaylorExpansionWithBound<K>(polynom, x[k]);
+
+        ASSERT_EQ(taylor.coeffs, out[k]);
+        ASSERT_EQ(taylor.coeffs, bounded[k].coeffs);
+        ASSERT_EQ(taylor.bound, bounded[k].bound);
+    }
+}